@@ -0,0 +1,402 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include "POLICY.h"
+#include "POLICY_OPT.h"
+#include "SMALL_SET.h"
+
+#define BENCH_ACCESSES 20000000L   // Accesos medidos por cada número de frames
+#define BENCH_MAX_FRAMES (1 << 20) // Mayor número de frames a medir
+#define BENCH_LOOKUPS 50000000L    // Búsquedas medidas por cada tamaño del conjunto pequeño
+#define BENCH_QUERIES 4096         // Páginas buscadas (se repiten en ciclo; potencia de dos)
+#define BENCH_MAX_REPETITIONS 100  // Repeticiones medidas como máximo por caso de la suite
+
+// Conteo de reservas de memoria: solo en un ejecutable de medición compilado con
+// -DBENCH_COUNT_ALLOCATIONS y con el enlazador redirigiendo las funciones de reserva a las de aquí:
+//   -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=posix_memalign,--wrap=aligned_alloc,--wrap=memalign
+// Cada versión cuenta la llamada y delega en la original (__real_*), así no se reemplaza el
+// asignador y funciona con cualquier libc o sanitizador. Solo se cuentan las llamadas del programa
+// (no las internas de la biblioteca). En la compilación normal no se cuenta nada y la suite informa
+// las reservas como no disponibles.
+#ifdef BENCH_COUNT_ALLOCATIONS
+#define BENCH_ALLOCATIONS_COUNTED 1
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *pointer, size_t size);
+int __real_posix_memalign(void **pointer, size_t alignment, size_t size);
+void *__real_aligned_alloc(size_t alignment, size_t size);
+void *__real_memalign(size_t alignment, size_t size);
+static uint64_t benchAllocations = 0;   // Reservas desde que empezó el programa (todos los hilos)
+
+void *__wrap_malloc(size_t size) {
+    __atomic_fetch_add(&benchAllocations, 1, __ATOMIC_RELAXED);
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    __atomic_fetch_add(&benchAllocations, 1, __ATOMIC_RELAXED);
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *pointer, size_t size) {
+    __atomic_fetch_add(&benchAllocations, 1, __ATOMIC_RELAXED);
+    return __real_realloc(pointer, size);
+}
+
+int __wrap_posix_memalign(void **pointer, size_t alignment, size_t size) {
+    __atomic_fetch_add(&benchAllocations, 1, __ATOMIC_RELAXED);
+    return __real_posix_memalign(pointer, alignment, size);
+}
+
+void *__wrap_aligned_alloc(size_t alignment, size_t size) {
+    __atomic_fetch_add(&benchAllocations, 1, __ATOMIC_RELAXED);
+    return __real_aligned_alloc(alignment, size);
+}
+
+void *__wrap_memalign(size_t alignment, size_t size) {
+    __atomic_fetch_add(&benchAllocations, 1, __ATOMIC_RELAXED);
+    return __real_memalign(alignment, size);
+}
+
+// Función para obtener el número de reservas hechas hasta ahora
+static inline uint64_t benchAllocationCount() {
+    return __atomic_load_n(&benchAllocations, __ATOMIC_RELAXED);
+}
+#else
+#define BENCH_ALLOCATIONS_COUNTED 0
+
+static inline uint64_t benchAllocationCount() {
+    return 0;
+}
+#endif
+
+// Función para elegir una página en [0, universe) sin dividir (multiplicación y desplazamiento)
+static inline PageId randomPage(uint64_t *state, uint64_t universe) {
+    return (PageId)(((nextRandom(state) >> 32) * universe) >> 32);
+}
+
+// Función para medir el rendimiento (accesos por segundo) de una política según el número de frames
+// Las páginas se eligen uniformemente entre pagesPerFrame * frames páginas distintas (con 2.0 hay
+// ~50% de aciertos), por lo que si el costo por acceso es O(1) la curva debe mantenerse plana
+static inline int runBenchmark(const PolicyOps *ops, double pagesPerFrame) {
+    printf("%10s %16s %10s\n", "Frames", "Accesos/s", "Aciertos");
+
+    for (int frames = 4; frames <= BENCH_MAX_FRAMES; frames *= 4) {
+        Policy *policy = createPolicy(ops, frames);
+        if (policy == NULL) {
+            printf("No hay memoria suficiente para %d frames\n", frames);
+            return 1;
+        }
+
+        uint64_t state = 0x9E3779B97F4A7C15ULL;
+        uint64_t universe = (uint64_t)(frames * pagesPerFrame);
+
+        // Calentamiento: llenar la memoria antes de medir
+        for (uint64_t i = 0; i < universe; ++i) {
+            policyAccess(policy, randomPage(&state, universe), NEVER, NULL);
+        }
+
+        long hits = 0;
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (long i = 0; i < BENCH_ACCESSES; ++i) {
+            hits += policyAccess(policy, randomPage(&state, universe), NEVER, NULL);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+        printf("%10d %16.0f %9.2f%%\n", frames, BENCH_ACCESSES / seconds, 100.0 * hits / BENCH_ACCESSES);
+        destroyPolicy(policy);
+    }
+    return 0;
+}
+
+// Resultado de una política sobre una traza en la suite de rendimiento
+typedef struct BenchResult {
+    char policy[16];            // Nombre corto de la política
+    char trace[64];             // Nombre de la traza
+    int frames;                 // Número de frames
+    uint64_t accesses;          // Accesos por repetición
+    int repetitions;            // Repeticiones medidas (sin contar el calentamiento)
+    double hitRatio;            // Tasa de aciertos (igual en todas las repeticiones)
+    double nsMean;              // Nanosegundos por acceso: media, desviación estándar, mínimo,
+    double nsStddev;            // mediana y máximo de las repeticiones
+    double nsMin;
+    double nsMedian;
+    double nsMax;
+    double allocationsPerAccess; // Reservas de memoria por acceso durante los accesos medidos (-1 = no disponible)
+    long peakKiB;               // Memoria residente pico que agregó el caso (creación de la política incluida)
+    bool ok;                    // Indica si el caso terminó bien
+} BenchResult;
+
+// Función para comparar dos números de punto flotante (para qsort)
+static inline int compareDoubles(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Función para calcular la media, la desviación estándar y los percentiles de las repeticiones
+static inline void summarizeBenchSamples(BenchResult *result, double *samples, int count) {
+    qsort(samples, (size_t)count, sizeof(double), compareDoubles);
+    double sum = 0.0;
+    for (int i = 0; i < count; ++i) {
+        sum += samples[i];
+    }
+    double mean = sum / count;
+    double squares = 0.0;
+    for (int i = 0; i < count; ++i) {
+        squares += (samples[i] - mean) * (samples[i] - mean);
+    }
+    result->nsMean = mean;
+    result->nsStddev = count > 1 ? sqrt(squares / (count - 1)) : 0.0;
+    result->nsMin = samples[0];
+    result->nsMax = samples[count - 1];
+    result->nsMedian = count % 2 == 1 ? samples[count / 2] : (samples[count / 2 - 1] + samples[count / 2]) / 2;
+}
+
+// Función para medir una política sobre una traza en memoria: 'warmup' pasadas sin medir (calientan
+// la caché del procesador y el predictor de saltos) y después 'repetitions' pasadas medidas, cada
+// una con la política recién creada para que todas simulen lo mismo. Solo se cronometran los accesos.
+static inline bool measureBenchCase(const PolicyOps *ops, int frames, const PageId *trace, uint32_t count,
+                                    int warmup, int repetitions, BenchResult *result) {
+    uint32_t *nextUse = NULL;
+    if (ops->needsFuture) {
+        nextUse = (uint32_t *)malloc(((size_t)count + 1) * sizeof(uint32_t));
+        if (nextUse == NULL || !computeNextUse(trace, count, nextUse)) {
+            free(nextUse);
+            return false;
+        }
+    }
+    double samples[BENCH_MAX_REPETITIONS];
+    uint64_t allocations = 0;
+    uint64_t hits = 0;
+    for (int run = 0; run < warmup + repetitions; ++run) {
+        Policy *policy = createPolicy(ops, frames);
+        if (policy == NULL) {
+            free(nextUse);
+            return false;
+        }
+        uint64_t before = benchAllocationCount();
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        if (nextUse != NULL) {
+            for (uint32_t t = 0; t < count; ++t) {
+                policyAccess(policy, trace[t], nextUse[t] == NEVER32 ? NEVER : nextUse[t], NULL);
+            }
+        } else {
+            for (uint32_t t = 0; t < count; ++t) {
+                policyAccess(policy, trace[t], NEVER, NULL);
+            }
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        if (run >= warmup) {
+            double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+            samples[run - warmup] = seconds * 1e9 / count;
+            allocations += benchAllocationCount() - before;
+        }
+        hits = policy->stats.hits;
+        destroyPolicy(policy);
+    }
+    free(nextUse);
+
+    result->accesses = count;
+    result->repetitions = repetitions;
+    result->hitRatio = count > 0 ? (double)hits / count : 0.0;
+    result->allocationsPerAccess = BENCH_ALLOCATIONS_COUNTED ? (double)allocations / ((double)count * repetitions) : -1.0;
+    summarizeBenchSamples(result, samples, repetitions);
+    return true;
+}
+
+// Función para medir un caso en un proceso hijo: así la memoria pico es solo la de ese caso (el hijo
+// resta la memoria que ya tenía al nacer, que incluye la traza) y un caso no afecta a los siguientes
+static inline bool runIsolatedBenchCase(const PolicyOps *ops, int frames, const PageId *trace, uint32_t count,
+                                        int warmup, int repetitions, BenchResult *result) {
+    memset(result, 0, sizeof(BenchResult));
+    snprintf(result->policy, sizeof(result->policy), "%s", ops->name);
+    result->frames = frames;
+    if (repetitions < 1 || repetitions > BENCH_MAX_REPETITIONS || count == 0) {
+        return false;
+    }
+    int channel[2];
+    if (pipe(channel) != 0) {
+        return false;
+    }
+    fflush(stdout);
+    pid_t child = fork();
+    if (child < 0) {
+        close(channel[0]);
+        close(channel[1]);
+        return false;
+    }
+    if (child == 0) {
+        close(channel[0]);
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        long baseKiB = usage.ru_maxrss;
+        result->ok = measureBenchCase(ops, frames, trace, count, warmup, repetitions, result);
+        getrusage(RUSAGE_SELF, &usage);
+        result->peakKiB = usage.ru_maxrss - baseKiB;
+        bool sent = write(channel[1], result, sizeof(BenchResult)) == (ssize_t)sizeof(BenchResult);
+        _exit(sent ? 0 : 1);
+    }
+    close(channel[1]);
+    BenchResult received;
+    bool ok = read(channel[0], &received, sizeof(BenchResult)) == (ssize_t)sizeof(BenchResult);
+    close(channel[0]);
+    int status;
+    ok = waitpid(child, &status, 0) == child && ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    if (ok) {
+        memcpy(result, &received, sizeof(BenchResult));
+    }
+    return ok && result->ok;
+}
+
+// Función para imprimir el encabezado de la tabla de la suite
+static inline void printBenchHeader() {
+    printf("%-12s %-10s %8s %9s %9s %8s %9s %9s %11s %10s\n", "Traza", "Política", "Frames", "Aciertos",
+           "ns/acc", "±", "mínimo", "mediana", "Reservas/acc", "Pico KiB");
+}
+
+// Función para imprimir una fila de la tabla de la suite
+static inline void printBenchResult(const BenchResult *result) {
+    printf("%-12s %-10s %8d %8.2f%% %9.1f %8.1f %9.1f %9.1f ", result->trace, result->policy, result->frames,
+           100.0 * result->hitRatio, result->nsMean, result->nsStddev, result->nsMin, result->nsMedian);
+    if (result->allocationsPerAccess < 0) {
+        printf("%11s", "n/d");
+    } else {
+        printf("%11.4f", result->allocationsPerAccess);
+    }
+    printf(" %10ld\n", result->peakKiB);
+}
+
+// Función para escribir los resultados de la suite en CSV (o en JSON si el nombre termina en
+// ".json"), con una fila por caso; 'label' identifica la versión medida para comparar archivos
+static inline bool writeBenchResults(const char *path, const char *label, const BenchResult *results, int count) {
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        return false;
+    }
+    size_t length = strlen(path);
+    bool json = length >= 5 && strcmp(path + length - 5, ".json") == 0;
+    if (json) {
+        fprintf(file, "[\n");
+    } else {
+        fprintf(file, "label,trace,policy,frames,accesses,repetitions,hit_ratio,ns_mean,ns_stddev,ns_min,"
+                      "ns_median,ns_max,allocations_per_access,peak_kib\n");
+    }
+    for (int i = 0; i < count; ++i) {
+        const BenchResult *r = &results[i];
+        if (json) {
+            fprintf(file, "  {\"label\": \"%s\", \"trace\": \"%s\", \"policy\": \"%s\", \"frames\": %d, "
+                          "\"accesses\": %llu, \"repetitions\": %d, \"hit_ratio\": %.6f, \"ns_mean\": %.3f, "
+                          "\"ns_stddev\": %.3f, \"ns_min\": %.3f, \"ns_median\": %.3f, \"ns_max\": %.3f, ",
+                    label, r->trace, r->policy, r->frames, (unsigned long long)r->accesses, r->repetitions,
+                    r->hitRatio, r->nsMean, r->nsStddev, r->nsMin, r->nsMedian, r->nsMax);
+            if (r->allocationsPerAccess < 0) {
+                fprintf(file, "\"allocations_per_access\": null, ");
+            } else {
+                fprintf(file, "\"allocations_per_access\": %.6f, ", r->allocationsPerAccess);
+            }
+            fprintf(file, "\"peak_kib\": %ld}%s\n", r->peakKiB, i + 1 < count ? "," : "");
+        } else {
+            fprintf(file, "%s,%s,%s,%d,%llu,%d,%.6f,%.3f,%.3f,%.3f,%.3f,%.3f,", label, r->trace, r->policy, r->frames,
+                    (unsigned long long)r->accesses, r->repetitions, r->hitRatio, r->nsMean, r->nsStddev, r->nsMin,
+                    r->nsMedian, r->nsMax);
+            if (r->allocationsPerAccess >= 0) {
+                fprintf(file, "%.6f", r->allocationsPerAccess);
+            }
+            fprintf(file, ",%ld\n", r->peakKiB);
+        }
+    }
+    if (json) {
+        fprintf(file, "]\n");
+    }
+    return fclose(file) == 0;
+}
+
+// Función para medir el costo de buscar una página en un conjunto pequeño con cada implementación
+// que admite el procesador y con el índice, según el número de frames; la mitad de las búsquedas
+// son aciertos y todas las implementaciones deben devolver la misma ranura
+static inline int runSmallSetBenchmark() {
+    SmallSetKernel kernels[3];
+    int numKernels = smallSetKernels(kernels);
+    PageId *queries = (PageId *)malloc(BENCH_QUERIES * sizeof(PageId));
+    if (queries == NULL) {
+        printf("No hay memoria suficiente para la prueba\n");
+        return 1;
+    }
+    printf("%10s", "Frames");
+    for (int k = 0; k < numKernels; ++k) {
+        printf(" %11s", kernels[k].name);
+    }
+    printf(" %11s\n", "índice");
+
+    for (int frames = 4; frames <= SMALL_SET_MAX_SLOTS; frames *= 2) {
+        PageId *pages = createSmallSet(frames);
+        PageIndex *index = createPageIndex((uint64_t)frames * 2);
+        if (pages == NULL || index == NULL) {
+            printf("No hay memoria suficiente para %d frames\n", frames);
+            free(pages);
+            destroyPageIndex(index);
+            free(queries);
+            return 1;
+        }
+        uint64_t state = 0x9E3779B97F4A7C15ULL;
+        for (int i = 0; i < frames; ++i) {
+            pages[i] = (PageId)i * 7 + 3;
+            indexInsert(index, pages[i], (uint64_t)i);
+        }
+        for (int i = 0; i < BENCH_QUERIES; ++i) {
+            queries[i] = randomPage(&state, 2 * (uint64_t)frames) * 7 + 3;
+        }
+
+        printf("%10d", frames);
+        int slots = smallSetSlots(frames);
+        long expected = 0;
+        for (int k = 0; k < numKernels + 1; ++k) {
+            // El puntero volátil evita que el compilador saque la búsqueda del ciclo
+            SmallSetFind volatile find = k < numKernels ? kernels[k].find : NULL;
+            long found = 0;
+            struct timespec start, end;
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            for (long i = 0; i < BENCH_LOOKUPS; ++i) {
+                PageId page = queries[i & (BENCH_QUERIES - 1)];
+                if (find != NULL) {
+                    found += find(pages, slots, page);
+                } else {
+                    uint64_t *value = indexFind(index, page);
+                    found += value != NULL ? (long)*value : -1;
+                }
+            }
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+            if (k == 0) {
+                expected = found;
+            } else if (found != expected) {
+                printf("\nLas búsquedas no coinciden con %s\n", k < numKernels ? kernels[k].name : "el índice");
+                free(pages);
+                destroyPageIndex(index);
+                free(queries);
+                return 1;
+            }
+            printf(" %8.2f ns", seconds * 1e9 / BENCH_LOOKUPS);
+        }
+        printf("\n");
+        free(pages);
+        destroyPageIndex(index);
+    }
+    free(queries);
+    return 0;
+}
+
+#endif
@@ -0,0 +1,220 @@
+#ifndef CACHE_TIERS_H
+#define CACHE_TIERS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "POLICIES.h"
+#include "WORKLOAD.h"
+
+// Jerarquía de niveles de memoria (por ejemplo DRAM, memoria comprimida y swap en NVMe), cada uno
+// con su política, sus frames y su latencia. Un acceso lo atiende el primer nivel que tiene la
+// página y cuesta la latencia de ese nivel; si ningún nivel la tiene se lee del almacenamiento de
+// respaldo y cuesta la latencia de fallo.
+//  - Inclusiva: cada nivel contiene las páginas de los de arriba. Un fallo en un nivel se busca en
+//    el siguiente (que solo ve los fallos del anterior) y todos los niveles recorridos cargan la
+//    página, así que un acierto abajo la copia hacia arriba. La víctima del primer nivel no baja
+//    porque el segundo ya la tiene; la de un nivel inferior se quita también de los de arriba
+//    (invalidación hacia atrás) para mantener la inclusión.
+//  - Exclusiva: cada página está en un solo nivel. Un acierto abajo la quita de su nivel y la sube
+//    al primero, y la víctima de cada nivel baja al siguiente (la del último se descarta).
+// En los dos modos OPT solo puede ser el primer nivel: el próximo uso que se conoce es el de la
+// traza, pero un nivel inferior solo ve los fallos de los de arriba (inclusiva) o las páginas
+// bajadas (exclusiva), y su próximo uso real es otro, así que no sería el óptimo de ese nivel.
+// Las políticas de los niveles deben poder quitar una página (remove en PolicyOps).
+
+#define MAX_TIERS 8   // Niveles como máximo en una jerarquía
+
+enum TierMode { TIER_INCLUSIVE, TIER_EXCLUSIVE };
+
+static const char *const tierModeNames[] = {"inclusive", "exclusive"};
+
+// Descripción de un nivel ("política:frames@ns")
+typedef struct TierSpec {
+    const PolicyOps *ops;   // Política del nivel
+    int frames;             // Frames del nivel
+    double latency;         // Latencia de un acierto en el nivel (ns)
+} TierSpec;
+
+// Nivel de la jerarquía con sus contadores
+typedef struct Tier {
+    Policy *policy;         // Política con los frames del nivel
+    double latency;         // Latencia de un acierto en el nivel (ns)
+    uint64_t lookups;       // Accesos que llegaron a buscar la página en este nivel
+    uint64_t hits;          // Accesos atendidos por este nivel
+    uint64_t demotions;     // Páginas bajadas desde el nivel de arriba (exclusiva)
+    uint64_t invalidations; // Páginas quitadas por una expulsión de abajo (inclusiva)
+} Tier;
+
+// Jerarquía de niveles
+typedef struct TierHierarchy {
+    int mode;               // TIER_INCLUSIVE o TIER_EXCLUSIVE
+    Tier tiers[MAX_TIERS];
+    int numTiers;
+    double missLatency;     // Latencia de un fallo en todos los niveles (ns)
+    uint64_t accesses;      // Accesos simulados
+    uint64_t misses;        // Accesos que no atendió ningún nivel
+} TierHierarchy;
+
+// Función para leer los niveles "política:frames@ns,..." (frames con sufijo k o M opcional);
+// devuelve cuántos niveles leyó o 0 si la especificación no es válida
+static inline int parseTierSpec(const char *text, TierSpec *specs) {
+    int count = 0;
+    const char *c = text;
+    while (*c != '\0' && count < MAX_TIERS) {
+        const char *colon = strchr(c, ':');
+        char name[32];
+        if (colon == NULL || colon == c || colon - c >= (long)sizeof(name)) {
+            return 0;
+        }
+        memcpy(name, c, (size_t)(colon - c));
+        name[colon - c] = '\0';
+        specs[count].ops = findPolicy(name);
+        c = colon + 1;
+        uint64_t frames;
+        if (specs[count].ops == NULL || !parseWorkloadCount(&c, &frames) || frames == 0 || frames > MAX_FRAMES ||
+            *c != '@') {
+            return 0;
+        }
+        specs[count].frames = (int)frames;
+        char *end;
+        specs[count].latency = strtod(c + 1, &end);
+        if (end == c + 1 || specs[count].latency < 0.0 || (*end != ',' && *end != '\0') || (*end == ',' && end[1] == '\0')) {
+            return 0;
+        }
+        count++;
+        c = *end == ',' ? end + 1 : end;
+    }
+    return *c == '\0' ? count : 0;
+}
+
+// Función para liberar una jerarquía
+static inline void destroyTierHierarchy(TierHierarchy *hierarchy) {
+    if (hierarchy == NULL) {
+        return;
+    }
+    for (int i = 0; i < hierarchy->numTiers; ++i) {
+        destroyPolicy(hierarchy->tiers[i].policy);
+    }
+    free(hierarchy);
+}
+
+// Función para crear una jerarquía con los niveles indicados (NULL si falta memoria)
+static inline TierHierarchy* createTierHierarchy(const TierSpec *specs, int count, int mode, double missLatency) {
+    TierHierarchy *hierarchy = (TierHierarchy *)calloc(1, sizeof(TierHierarchy));
+    if (hierarchy == NULL) {
+        return NULL;
+    }
+    hierarchy->mode = mode;
+    hierarchy->missLatency = missLatency;
+    for (int i = 0; i < count; ++i) {
+        hierarchy->tiers[i].policy = createPolicy(specs[i].ops, specs[i].frames);
+        hierarchy->tiers[i].latency = specs[i].latency;
+        if (hierarchy->tiers[i].policy == NULL) {
+            destroyTierHierarchy(hierarchy);
+            return NULL;
+        }
+        hierarchy->numTiers++;
+    }
+    return hierarchy;
+}
+
+// Función para simular un acceso en una jerarquía inclusiva; devuelve el nivel que lo atendió
+static inline int inclusiveAccess(TierHierarchy *hierarchy, PageId page, uint64_t nextUse) {
+    for (int i = 0; i < hierarchy->numTiers; ++i) {
+        Tier *tier = &hierarchy->tiers[i];
+        PageId victim = NO_PAGE;
+        tier->lookups++;
+        bool hit = policyAccess(tier->policy, page, nextUse, &victim);
+        for (int j = 0; victim != NO_PAGE && j < i; ++j) {
+            if (policyRemove(hierarchy->tiers[j].policy, victim)) {
+                hierarchy->tiers[j].invalidations++;
+            }
+        }
+        if (hit) {
+            tier->hits++;
+            return i;
+        }
+    }
+    return hierarchy->numTiers;
+}
+
+// Función para simular un acceso en una jerarquía exclusiva; devuelve el nivel que lo atendió
+static inline int exclusiveAccess(TierHierarchy *hierarchy, PageId page, uint64_t nextUse) {
+    Tier *tiers = hierarchy->tiers;
+    PageId victim = NO_PAGE;
+    tiers[0].lookups++;
+    if (policyAccess(tiers[0].policy, page, nextUse, &victim)) {
+        tiers[0].hits++;
+        return 0;
+    }
+
+    // La página ya se cargó arriba: se quita del nivel de abajo que la tenía (antes de bajar la
+    // víctima, así ese nivel tiene un frame libre para recibirla)
+    int level = hierarchy->numTiers;
+    for (int i = 1; i < hierarchy->numTiers; ++i) {
+        tiers[i].lookups++;
+        if (policyRemove(tiers[i].policy, page)) {
+            tiers[i].hits++;
+            level = i;
+            break;
+        }
+    }
+
+    // Cada víctima baja al nivel siguiente, que puede expulsar a su vez otra
+    for (int i = 1; victim != NO_PAGE && i < hierarchy->numTiers; ++i) {
+        PageId demoted = victim;
+        victim = NO_PAGE;
+        policyAccess(tiers[i].policy, demoted, NEVER, &victim);
+        tiers[i].demotions++;
+    }
+    return level;
+}
+
+// Función para simular un acceso en la jerarquía; devuelve el nivel que lo atendió (numTiers si
+// ningún nivel tenía la página)
+static inline int tierAccess(TierHierarchy *hierarchy, PageId page, uint64_t nextUse) {
+    int level = hierarchy->mode == TIER_EXCLUSIVE ? exclusiveAccess(hierarchy, page, nextUse)
+                                                  : inclusiveAccess(hierarchy, page, nextUse);
+    hierarchy->accesses++;
+    if (level == hierarchy->numTiers) {
+        hierarchy->misses++;
+    }
+    return level;
+}
+
+// Función para calcular la latencia media por acceso de la jerarquía (ns)
+static inline double tierEffectiveLatency(const TierHierarchy *hierarchy) {
+    if (hierarchy->accesses == 0) {
+        return 0.0;
+    }
+    double total = (double)hierarchy->misses * hierarchy->missLatency;
+    for (int i = 0; i < hierarchy->numTiers; ++i) {
+        total += (double)hierarchy->tiers[i].hits * hierarchy->tiers[i].latency;
+    }
+    return total / (double)hierarchy->accesses;
+}
+
+// Función para imprimir los contadores de cada nivel y la latencia efectiva de la jerarquía
+static inline void printTierHierarchy(const TierHierarchy *hierarchy) {
+    uint64_t accesses = hierarchy->accesses > 0 ? hierarchy->accesses : 1;
+    printf("Jerarquía %s, %llu accesos\n", tierModeNames[hierarchy->mode], (unsigned long long)hierarchy->accesses);
+    printf("%-6s %-10s %8s %10s %12s %12s %10s %10s %12s %12s\n", "Nivel", "Política", "Frames", "Latencia",
+           "Consultas", "Aciertos", "Aciertos%", "Locales%", "Bajadas", "Invalidadas");
+    for (int i = 0; i < hierarchy->numTiers; ++i) {
+        const Tier *tier = &hierarchy->tiers[i];
+        printf("%-6d %-9s %8d %10.0f %12llu %12llu %9.2f%% %9.2f%% %12llu %12llu\n", i + 1, tier->policy->ops->name,
+               tier->policy->capacity, tier->latency, (unsigned long long)tier->lookups, (unsigned long long)tier->hits,
+               100.0 * (double)tier->hits / (double)accesses,
+               tier->lookups > 0 ? 100.0 * (double)tier->hits / (double)tier->lookups : 0.0,
+               (unsigned long long)tier->demotions, (unsigned long long)tier->invalidations);
+    }
+    printf("%-6s %-9s %8s %10.0f %12llu %12llu %9.2f%% %9.2f%%\n", "fallo", "-", "-", hierarchy->missLatency,
+           (unsigned long long)hierarchy->misses, (unsigned long long)hierarchy->misses,
+           100.0 * (double)hierarchy->misses / (double)accesses, 100.0);
+    printf("Latencia efectiva: %.1f ns por acceso\n", tierEffectiveLatency(hierarchy));
+}
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "FRAME_LIST.h"
+
+// Registro binario de eventos de una simulación, un registro de tamaño fijo por acceso y política:
+// cabecera de 8 bytes ("PGEV", versión, tamaño del registro, 2 bytes reservados) seguida de
+// registros EventRecord en el orden de la máquina (little-endian en x86 y ARM).
+// Los registros se acumulan en un búfer y se escriben con una sola llamada a write() cuando se
+// llena, así que registrar un evento no hace E/S ni llamadas a printf.
+#define EVENT_MAGIC "PGEV"
+#define EVENT_VERSION 1
+#define EVENT_HEADER_SIZE 8
+#define EVENT_BUFFER_RECORDS (1 << 15)   // Registros por escritura (1 MiB)
+
+// Evento de un acceso a una página
+typedef struct EventRecord {
+    uint64_t access;        // Número de acceso dentro de la traza (desde 0)
+    int64_t page;           // Página accedida
+    int64_t victim;         // Página expulsada (NO_PAGE si no hubo expulsión)
+    uint32_t policy;        // Índice de la política dentro de la simulación
+    uint8_t hit;            // 1 si fue un acierto, 0 si fue un fallo de página
+    uint8_t reserved[3];    // Relleno (siempre 0)
+} EventRecord;
+
+// Estructura para escribir el registro de eventos
+typedef struct EventLog {
+    int fd;                 // Descriptor del archivo de salida
+    EventRecord *records;   // Búfer de registros pendientes
+    uint32_t pending;       // Número de registros en el búfer
+    uint64_t written;       // Número de registros escritos en total
+    bool failed;            // Indica si hubo un error de escritura
+} EventLog;
+
+// Función para escribir todos los bytes de un búfer (write puede escribir solo una parte)
+static inline bool writeAll(int fd, const void *data, size_t bytes) {
+    const unsigned char *pos = (const unsigned char *)data;
+    while (bytes > 0) {
+        ssize_t n = write(fd, pos, bytes);
+        if (n <= 0) {
+            return false;
+        }
+        pos += n;
+        bytes -= (size_t)n;
+    }
+    return true;
+}
+
+// Función para crear el registro de eventos en 'path'
+static inline EventLog* createEventLog(const char *path) {
+    EventLog *log = (EventLog *)calloc(1, sizeof(EventLog));
+    if (log == NULL) {
+        return NULL;
+    }
+    log->records = (EventRecord *)malloc(EVENT_BUFFER_RECORDS * sizeof(EventRecord));
+    log->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    unsigned char header[EVENT_HEADER_SIZE] = {'P', 'G', 'E', 'V', EVENT_VERSION, (unsigned char)sizeof(EventRecord), 0, 0};
+    if (log->records == NULL || log->fd < 0 || !writeAll(log->fd, header, sizeof(header))) {
+        if (log->fd >= 0) close(log->fd);
+        free(log->records);
+        free(log);
+        return NULL;
+    }
+    return log;
+}
+
+// Función para escribir los registros pendientes
+static inline void flushEventLog(EventLog *log) {
+    if (log->pending > 0 && !log->failed) {
+        log->failed = !writeAll(log->fd, log->records, log->pending * sizeof(EventRecord));
+    }
+    log->written += log->pending;
+    log->pending = 0;
+}
+
+// Función para registrar un acceso
+static inline void logEvent(EventLog *log, uint64_t access, uint32_t policy, PageId page, bool hit, PageId victim) {
+    EventRecord *record = &log->records[log->pending];
+    record->access = access;
+    record->page = page;
+    record->victim = victim;
+    record->policy = policy;
+    record->hit = hit ? 1 : 0;
+    memset(record->reserved, 0, sizeof(record->reserved));
+    if (++log->pending == EVENT_BUFFER_RECORDS) {
+        flushEventLog(log);
+    }
+}
+
+// Función para cerrar el registro de eventos; devuelve false si hubo un error de escritura
+static inline bool closeEventLog(EventLog *log) {
+    flushEventLog(log);
+    bool ok = !log->failed;
+    ok = close(log->fd) == 0 && ok;
+    free(log->records);
+    free(log);
+    return ok;
+}
+
+#endif
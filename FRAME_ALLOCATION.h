@@ -0,0 +1,420 @@
+#ifndef FRAME_ALLOCATION_H
+#define FRAME_ALLOCATION_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "POLICY.h"
+#include "PAGE_INDEX.h"
+
+// Reparto de frames entre varios procesos. Cada referencia de la traza lleva el número de proceso
+// en los bits altos de la página (ver PID_SHIFT en FRAME_LIST.h), así la misma página virtual de
+// dos procesos son páginas distintas. Hay cuatro modos:
+//  - global: una sola instancia de la política con todos los frames; un fallo puede expulsar una
+//    página de cualquier proceso
+//  - local: cada proceso tiene su propia instancia y una parte igual de los frames (se reparte de
+//    nuevo cuando aparece un proceso)
+//  - ws:τ: la asignación de cada proceso es su conjunto de trabajo, las páginas distintas de sus
+//    últimas τ referencias (tiempo virtual del proceso)
+//  - pff:T: frecuencia de fallos; si entre dos fallos pasaron menos de T referencias del proceso
+//    la asignación crece un frame, y si pasaron T o más se reduce a las páginas usadas desde el
+//    fallo anterior
+// En ws y pff las asignaciones crecen solo con frames libres (no se quitan a otro proceso, salvo el
+// primer frame de un proceso nuevo); si un proceso pide más de lo que recibe queda "con hambre" y,
+// si la suma de lo que piden todos supera los frames, el sistema está sobrecargado
+// (hiperpaginación). Al reducir una asignación se expulsan páginas con la operación evict de la
+// política: con LRU salen justo las páginas que dejaron el conjunto de trabajo (o las no usadas
+// desde el último fallo), así que ws y pff son exactos; con otras políticas son aproximados.
+// El conjunto de trabajo se mantiene con un anillo de las últimas τ referencias y un índice
+// página -> último uso: cada referencia entra al anillo y la que sale deja el conjunto solo si no
+// se volvió a usar. Cuesta O(1) por referencia, sin volver a recorrer la ventana.
+// Fuera del modo global cada proceso lleva el índice de sus páginas cargadas: en un fallo se
+// expulsa primero hasta dejar un frame libre en su asignación y recién entonces se carga la página,
+// así la política nunca elige como víctima la página que está entrando (LFU, OPT o ARC lo harían).
+// La política local se crea con la asignación del proceso (ver fitProcessPolicy), así no hay una
+// política de todos los frames por proceso.
+
+#define ALLOC_MAX_PROCESSES 64   // Procesos distintos como máximo
+#define ALLOC_POLICY_FRAMES 64   // Capacidad mínima de la política local de un proceso (ws y pff)
+
+enum AllocationMode { ALLOC_GLOBAL, ALLOC_LOCAL, ALLOC_WORKING_SET, ALLOC_PFF };
+
+// Estado y contadores de un proceso
+typedef struct ProcessState {
+    uint64_t pid;               // Número de proceso
+    Policy *policy;             // Política local (NULL en el modo global y hasta el primer fallo)
+    uint64_t policyFrames;      // Capacidad de la política local
+    PageIndex *pages;           // Página cargada -> su próximo uso (salvo en el modo global)
+    uint64_t allocation;        // Frames asignados
+    uint64_t resident;          // Páginas cargadas
+    uint64_t demand;            // Frames que pide el controlador (ws y pff)
+    uint64_t clock;             // Tiempo virtual: referencias del proceso
+    PageIndex *lastUse;         // Página -> tiempo virtual de su último uso (ws y pff)
+    PageId *window;             // Anillo con las últimas τ páginas (ws)
+    uint64_t lastFault;         // Tiempo virtual del último fallo (pff)
+    uint64_t sinceFault;        // Páginas distintas usadas desde el último fallo (pff)
+    uint64_t accesses;          // Referencias
+    uint64_t faults;            // Fallos de página
+    uint64_t allocationSum;     // Suma de la asignación en cada referencia (para la media)
+    uint64_t maxAllocation;     // Mayor asignación
+    uint64_t starved;           // Referencias en las que pedía más frames de los asignados
+} ProcessState;
+
+// Simulación de varios procesos sobre 'capacity' frames
+typedef struct FrameAllocator {
+    int mode;                   // ALLOC_GLOBAL, ALLOC_LOCAL, ALLOC_WORKING_SET o ALLOC_PFF
+    uint64_t parameter;         // τ del conjunto de trabajo o T de pff
+    uint64_t capacity;          // Frames en total
+    uint64_t freeFrames;        // Frames sin asignar (ws y pff)
+    uint64_t totalDemand;       // Suma de lo que piden los procesos (ws y pff)
+    const PolicyOps *ops;       // Política de reemplazo
+    Policy *global;             // Política compartida (modo global)
+    ProcessState processes[ALLOC_MAX_PROCESSES];
+    int numProcesses;
+    uint64_t accesses;          // Referencias de todos los procesos
+    uint64_t overcommitted;     // Referencias con la demanda total mayor que los frames
+} FrameAllocator;
+
+// Función para obtener el número de proceso de una referencia
+static inline uint64_t processOf(PageId page) {
+    return (uint64_t)page >> PID_SHIFT;
+}
+
+// Función para leer el modo de reparto ("global", "local", "ws:τ" o "pff:T"); devuelve false si no es válido
+static inline bool parseAllocationMode(const char *text, int *mode, uint64_t *parameter) {
+    char *end;
+    *parameter = 0;
+    if (strcmp(text, "global") == 0) {
+        *mode = ALLOC_GLOBAL;
+    } else if (strcmp(text, "local") == 0) {
+        *mode = ALLOC_LOCAL;
+    } else if (strncmp(text, "ws:", 3) == 0) {
+        *mode = ALLOC_WORKING_SET;
+        *parameter = strtoull(text + 3, &end, 10);
+        return end != text + 3 && *end == '\0' && *parameter > 0;
+    } else if (strncmp(text, "pff:", 4) == 0) {
+        *mode = ALLOC_PFF;
+        *parameter = strtoull(text + 4, &end, 10);
+        return end != text + 4 && *end == '\0' && *parameter > 0;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Función para liberar la simulación de varios procesos
+static inline void destroyFrameAllocator(FrameAllocator *allocator) {
+    if (allocator == NULL) {
+        return;
+    }
+    destroyPolicy(allocator->global);
+    for (int i = 0; i < allocator->numProcesses; ++i) {
+        destroyPolicy(allocator->processes[i].policy);
+        destroyPageIndex(allocator->processes[i].pages);
+        destroyPageIndex(allocator->processes[i].lastUse);
+        free(allocator->processes[i].window);
+    }
+    free(allocator);
+}
+
+// Función para crear la simulación de varios procesos con 'capacity' frames en total
+static inline FrameAllocator* createFrameAllocator(const PolicyOps *ops, int capacity, int mode, uint64_t parameter) {
+    FrameAllocator *allocator = (FrameAllocator *)calloc(1, sizeof(FrameAllocator));
+    if (allocator == NULL) {
+        return NULL;
+    }
+    allocator->mode = mode;
+    allocator->parameter = parameter;
+    allocator->capacity = (uint64_t)capacity;
+    allocator->freeFrames = (uint64_t)capacity;
+    allocator->ops = ops;
+    if (mode == ALLOC_GLOBAL) {
+        allocator->global = createPolicy(ops, capacity);
+        if (allocator->global == NULL) {
+            free(allocator);
+            return NULL;
+        }
+    }
+    return allocator;
+}
+
+// Función para expulsar páginas de un proceso hasta que le queden 'limit' cargadas
+static inline void shrinkProcess(ProcessState *process, uint64_t limit) {
+    while (process->resident > limit) {
+        PageId victim = policyEvict(process->policy);
+        if (victim == NO_PAGE) {
+            break;
+        }
+        indexRemove(process->pages, victim);
+        process->resident--;
+    }
+}
+
+// Función para que la política local de un proceso tenga lugar para toda su asignación: se crea en
+// el primer fallo y se reemplaza por otra cuando cambia el reparto. En el modo local la capacidad es
+// exactamente la asignación, porque ARC, 2Q o LIRS dependen de la capacidad y no solo de las páginas
+// cargadas (la asignación cambia solo cuando aparece un proceso); en ws y pff, donde cambia en cada
+// fallo, la política se agranda al doble cuando la asignación la supera. Las páginas cargadas pasan
+// a la nueva en el orden en que la anterior las expulsaría (con su próximo uso), así se conserva el
+// orden de FIFO, LRU y Clock y el futuro de OPT; la historia que no está en las páginas cargadas
+// (frecuencias de LFU, páginas fantasma de ARC o 2Q) se pierde
+static inline bool fitProcessPolicy(FrameAllocator *allocator, ProcessState *process) {
+    bool local = allocator->mode == ALLOC_LOCAL;
+    if (process->policy != NULL && (local ? process->allocation == process->policyFrames : process->allocation <= process->policyFrames)) {
+        return true;
+    }
+    uint64_t frames = process->policyFrames * 2 > ALLOC_POLICY_FRAMES ? process->policyFrames * 2 : ALLOC_POLICY_FRAMES;
+    frames = local || frames < process->allocation ? process->allocation : frames;
+    frames = frames > allocator->capacity ? allocator->capacity : frames;
+    Policy *policy = createPolicy(allocator->ops, (int)frames);
+    if (policy == NULL) {
+        return false;
+    }
+    if (process->policy != NULL) {
+        for (PageId page = policyEvict(process->policy); page != NO_PAGE; page = policyEvict(process->policy)) {
+            uint64_t *nextUse = indexFind(process->pages, page);
+            policyAccess(policy, page, nextUse != NULL ? *nextUse : NEVER, NULL);
+        }
+        destroyPolicy(process->policy);
+    }
+    process->policy = policy;
+    process->policyFrames = frames;
+    return true;
+}
+
+// Función para cambiar lo que pide un proceso y acercar su asignación: devuelve los frames que
+// sobran y toma frames libres si le faltan
+static inline void setProcessDemand(FrameAllocator *allocator, ProcessState *process, uint64_t demand) {
+    allocator->totalDemand += demand - process->demand;
+    process->demand = demand;
+    if (process->allocation > demand) {
+        allocator->freeFrames += process->allocation - demand;
+        process->allocation = demand;
+        shrinkProcess(process, process->allocation);
+    } else if (process->allocation < demand) {
+        uint64_t grant = demand - process->allocation < allocator->freeFrames ? demand - process->allocation : allocator->freeFrames;
+        allocator->freeFrames -= grant;
+        process->allocation += grant;
+    }
+}
+
+// Función para dar un frame a un proceso sin ninguno cuando no quedan libres: se lo quita al
+// proceso con la mayor asignación
+static inline bool stealFrame(FrameAllocator *allocator, ProcessState *process) {
+    ProcessState *richest = NULL;
+    for (int i = 0; i < allocator->numProcesses; ++i) {
+        ProcessState *other = &allocator->processes[i];
+        if (other != process && other->allocation > 1 && (richest == NULL || other->allocation > richest->allocation)) {
+            richest = other;
+        }
+    }
+    if (richest == NULL) {
+        return false;
+    }
+    richest->allocation--;
+    shrinkProcess(richest, richest->allocation);
+    process->allocation++;
+    return true;
+}
+
+// Función para buscar el estado de un proceso, creándolo la primera vez que aparece
+static inline ProcessState* findProcess(FrameAllocator *allocator, uint64_t pid) {
+    for (int i = 0; i < allocator->numProcesses; ++i) {
+        if (allocator->processes[i].pid == pid) {
+            return &allocator->processes[i];
+        }
+    }
+    if (allocator->numProcesses == ALLOC_MAX_PROCESSES) {
+        printf("La traza tiene más de %d procesos\n", ALLOC_MAX_PROCESSES);
+        return NULL;
+    }
+    ProcessState *process = &allocator->processes[allocator->numProcesses];
+    memset(process, 0, sizeof(ProcessState));
+    process->pid = pid;
+    if (allocator->mode == ALLOC_GLOBAL) {
+        allocator->numProcesses++;
+        return process;
+    }
+    process->pages = createPageIndex(1024);
+    if (allocator->mode != ALLOC_LOCAL) {
+        process->lastUse = createPageIndex(1024);
+    }
+    if (allocator->mode == ALLOC_WORKING_SET) {
+        process->window = (PageId *)malloc(allocator->parameter * sizeof(PageId));
+    }
+    if (process->pages == NULL || (allocator->mode != ALLOC_LOCAL && process->lastUse == NULL) ||
+        (allocator->mode == ALLOC_WORKING_SET && process->window == NULL)) {
+        printf("No hay memoria suficiente para el proceso %llu\n", (unsigned long long)pid);
+        destroyPageIndex(process->pages);
+        destroyPageIndex(process->lastUse);
+        free(process->window);
+        return NULL;
+    }
+    allocator->numProcesses++;
+    if (allocator->mode == ALLOC_LOCAL) {
+        // Repartir de nuevo los frames en partes iguales
+        uint64_t share = allocator->capacity / (uint64_t)allocator->numProcesses;
+        for (int i = 0; i < allocator->numProcesses; ++i) {
+            allocator->processes[i].allocation = share > 0 ? share : 1;
+            shrinkProcess(&allocator->processes[i], allocator->processes[i].allocation);
+        }
+    }
+    return process;
+}
+
+// Función para actualizar el conjunto de trabajo de un proceso con la referencia a 'page' en su
+// tiempo virtual 'now' (la página que sale de la ventana deja el conjunto si no se volvió a usar)
+static inline bool updateWorkingSet(FrameAllocator *allocator, ProcessState *process, PageId page, uint64_t now) {
+    uint64_t tau = allocator->parameter;
+    uint64_t size = process->lastUse->count;
+    if (now > tau) {
+        uint64_t leaving = now - tau;
+        PageId old = process->window[leaving % tau];
+        uint64_t *last = indexFind(process->lastUse, old);
+        if (*last == leaving) {
+            indexRemove(process->lastUse, old);
+            size--;
+        }
+    }
+    process->window[now % tau] = page;
+    uint64_t *last = indexFind(process->lastUse, page);
+    if (last != NULL) {
+        *last = now;
+    } else {
+        if (!indexInsert(process->lastUse, page, now)) {
+            return false;
+        }
+        size++;
+    }
+    setProcessDemand(allocator, process, size);
+    return true;
+}
+
+// Función para simular una referencia etiquetada con su proceso; devuelve false si no hay memoria
+static inline bool allocatorAccess(FrameAllocator *allocator, PageId page, uint64_t nextUse) {
+    ProcessState *process = findProcess(allocator, processOf(page));
+    if (process == NULL) {
+        return false;
+    }
+    uint64_t now = ++process->clock;
+    process->accesses++;
+    allocator->accesses++;
+
+    if (allocator->mode == ALLOC_GLOBAL) {
+        PageId victim;
+        if (!policyAccess(allocator->global, page, nextUse, &victim)) {
+            process->faults++;
+            process->resident++;
+            if (victim != NO_PAGE) {
+                findProcess(allocator, processOf(victim))->resident--;
+            }
+        }
+        process->allocation = process->resident; // En el modo global la asignación es lo que ocupa
+    } else {
+        if (allocator->mode == ALLOC_WORKING_SET && !updateWorkingSet(allocator, process, page, now)) {
+            return false;
+        }
+        bool firstUse = false;
+        if (allocator->mode == ALLOC_PFF) {
+            // Contar las páginas distintas usadas desde el último fallo
+            uint64_t *last = indexFind(process->lastUse, page);
+            if (last == NULL) {
+                if (!indexInsert(process->lastUse, page, now)) {
+                    return false;
+                }
+                firstUse = true;
+            } else {
+                if (*last <= process->lastFault) {
+                    process->sinceFault++;
+                }
+                *last = now;
+            }
+        }
+        // Se mira después de actualizar la demanda, que pudo haber expulsado la propia página
+        uint64_t *loaded = indexFind(process->pages, page);
+        if (loaded == NULL) {
+            process->faults++;
+            if (allocator->mode == ALLOC_PFF) {
+                // Fallos seguidos: crecer un frame; fallos espaciados: quedarse con lo usado desde el anterior
+                uint64_t interval = now - process->lastFault;
+                uint64_t used = process->sinceFault + (firstUse ? 1 : 0);
+                process->lastFault = now;
+                process->sinceFault = 0;
+                setProcessDemand(allocator, process, interval < allocator->parameter || process->demand == 0 ?
+                                 process->allocation + 1 : (used > 0 ? used : 1));
+            }
+            if (process->allocation == 0 && allocator->freeFrames > 0 && allocator->mode != ALLOC_LOCAL) {
+                allocator->freeFrames--;
+                process->allocation = 1;
+            } else if (process->allocation == 0) {
+                stealFrame(allocator, process);
+            }
+            shrinkProcess(process, process->allocation > 0 ? process->allocation - 1 : 0);
+            if (!fitProcessPolicy(allocator, process) || !indexInsert(process->pages, page, nextUse)) {
+                printf("No hay memoria suficiente para el proceso %llu\n", (unsigned long long)process->pid);
+                return false;
+            }
+            process->resident++;
+        } else {
+            *loaded = nextUse;
+            if (firstUse) {
+                process->sinceFault++;
+            }
+        }
+        PageId victim;
+        policyAccess(process->policy, page, nextUse, &victim);
+        if (victim != NO_PAGE) {
+            // La política expulsó por su cuenta (no debería, porque tenía un frame libre)
+            indexRemove(process->pages, victim);
+            process->resident--;
+        }
+        if (process->demand > process->allocation) {
+            process->starved++;
+        }
+        if (allocator->totalDemand > allocator->capacity) {
+            allocator->overcommitted++;
+        }
+    }
+    process->allocationSum += process->allocation;
+    if (process->allocation > process->maxAllocation) {
+        process->maxAllocation = process->allocation;
+    }
+    return true;
+}
+
+// Función para imprimir los fallos, la asignación y el hambre de cada proceso y del total
+static inline void printAllocationStats(const FrameAllocator *allocator) {
+    static const char *const modes[] = {"global", "local", "conjunto de trabajo", "frecuencia de fallos"};
+    printf("Reparto: %s", modes[allocator->mode]);
+    if (allocator->mode == ALLOC_WORKING_SET) {
+        printf(" (τ = %llu)", (unsigned long long)allocator->parameter);
+    } else if (allocator->mode == ALLOC_PFF) {
+        printf(" (T = %llu)", (unsigned long long)allocator->parameter);
+    }
+    printf(", política %s, %llu frames\n", allocator->ops->name, (unsigned long long)allocator->capacity);
+    printf("%8s %14s %14s %9s %12s %10s %9s\n", "Proceso", "Accesos", "Fallos", "Fallos%", "Asignación", "Máxima", "Hambre%");
+    uint64_t faults = 0;
+    for (int i = 0; i < allocator->numProcesses; ++i) {
+        const ProcessState *p = &allocator->processes[i];
+        faults += p->faults;
+        printf("%8llu %14llu %14llu %8.2f%% %12.1f %10llu", (unsigned long long)p->pid, (unsigned long long)p->accesses,
+               (unsigned long long)p->faults, 100.0 * p->faults / p->accesses, (double)p->allocationSum / p->accesses,
+               (unsigned long long)p->maxAllocation);
+        if (allocator->mode == ALLOC_WORKING_SET || allocator->mode == ALLOC_PFF) {
+            printf(" %8.2f%%\n", 100.0 * p->starved / p->accesses);
+        } else {
+            printf(" %9s\n", "-");
+        }
+    }
+    printf("%8s %14llu %14llu %8.2f%%\n", "Total", (unsigned long long)allocator->accesses, (unsigned long long)faults,
+           allocator->accesses > 0 ? 100.0 * faults / allocator->accesses : 0.0);
+    if (allocator->mode == ALLOC_WORKING_SET || allocator->mode == ALLOC_PFF) {
+        double overcommitted = allocator->accesses > 0 ? 100.0 * allocator->overcommitted / allocator->accesses : 0.0;
+        printf("Sobrecarga (demanda mayor que los frames): %.2f%% de las referencias%s\n", overcommitted,
+               overcommitted > 0.0 ? " - hiperpaginación" : "");
+    }
+}
+
+#endif
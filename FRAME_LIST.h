@@ -0,0 +1,223 @@
+#ifndef FRAME_LIST_H
+#define FRAME_LIST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// Las páginas válidas van de 0 a 2^63 - 1: el bit 63 es la marca de escritura de las trazas y las
+// páginas negativas (entre ellas NO_PAGE, que marca las ranuras vacías) están reservadas
+typedef int64_t PageId;   // Número de página virtual
+#define NO_PAGE (-1)      // Valor de página para un frame vacío o "sin víctima"
+#define PID_SHIFT 48      // Las trazas de varios procesos llevan el proceso en los bits 48..62 de la página
+#define MAX_PID ((1 << 15) - 1)
+#define WRITE_FLAG (1ULL << 63) // Bit que marca una escritura en las referencias de una traza (no es parte de la página)
+
+#define NIL_FRAME UINT32_MAX   // Índice nulo (equivale a un puntero NULL en la lista)
+#define MAX_FRAMES (INT32_MAX / 2) // Mayor número de frames de una política (los índices reservan el doble)
+#define CACHE_LINE 64          // Alineación del arreglo de frames
+
+// Función para obtener la página de una referencia sin la marca de escritura
+static inline PageId referencePage(uint64_t reference) {
+    return (PageId)(reference & ~WRITE_FLAG);
+}
+
+// Función para generar números pseudoaleatorios (xorshift64*) sin el costo de rand(); el estado
+// no puede ser 0. La usan las trazas de BENCH.h, el verificador, LRU por muestreo y el TLB aleatorio
+static inline uint64_t nextRandom(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 0x2545F4914F6CDD1DULL;
+}
+
+// Estructura para un frame de página en memoria física (común a todas las políticas)
+// Los enlaces son índices de 32 bits dentro del arreglo de frames de la lista
+typedef struct Frame {
+    PageId page;        // Número de página almacenada en el frame (valor -1 si está vacío)
+    uint32_t prev;      // Índice del frame previo (para lista doblemente enlazada)
+    uint32_t next;      // Índice del frame siguiente (para lista doblemente enlazada)
+    int frequency;      // Contador de frecuencia de acceso (LFU)
+    bool valid;         // Indica si el frame está ocupado (true) o vacío (false)
+    bool referenced;    // Bit de referencia (Clock)
+} Frame;
+
+// Estructura para la lista de frames en memoria física
+// Todos los frames se reservan juntos al crear la lista, así que cargar y expulsar
+// páginas no vuelve a llamar a malloc/free
+typedef struct FrameList {
+    int numFrames;      // Número de frames actualmente en la lista
+    int capacity;       // Número de frames del arreglo
+    uint32_t head;      // Índice del primer frame de la lista
+    uint32_t tail;      // Índice del último frame de la lista
+    uint32_t freeList;  // Índice del primer frame libre (enlazados por 'next')
+    Frame *frames;      // Arreglo contiguo de frames alineado a la línea de caché
+} FrameList;
+
+// Función para obtener el frame que corresponde a un índice
+static inline Frame* frameAt(FrameList *frameList, uint32_t frame) {
+    return &frameList->frames[frame];
+}
+
+// Función para inicializar la lista de frames con espacio para 'capacity' frames
+static inline FrameList* createFrameList(int capacity) {
+    FrameList *frameList = (FrameList *)malloc(sizeof(FrameList));
+    if (frameList == NULL) {
+        return NULL;
+    }
+
+    size_t bytes = ((size_t)capacity * sizeof(Frame) + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+    void *frames = NULL;
+    if (posix_memalign(&frames, CACHE_LINE, bytes > 0 ? bytes : CACHE_LINE) != 0) {
+        free(frameList);
+        return NULL;
+    }
+
+    frameList->numFrames = 0;
+    frameList->capacity = capacity;
+    frameList->head = NIL_FRAME;
+    frameList->tail = NIL_FRAME;
+    frameList->frames = (Frame *)frames;
+
+    // Encadenar todos los frames en la lista de libres
+    for (int i = 0; i < capacity; ++i) {
+        frameList->frames[i].next = i + 1 < capacity ? (uint32_t)(i + 1) : NIL_FRAME;
+    }
+    frameList->freeList = capacity > 0 ? 0 : NIL_FRAME;
+    return frameList;
+}
+
+// Función para inicializar una lista vacía que comparte el arreglo de frames de 'pool'
+// Así varias listas pueden intercambiar frames con unlinkFrame/insertFrame; los frames se toman
+// y se devuelven siempre en 'pool' (createFrame/freeFrame), nunca con removeFrame sobre la vista
+static inline void initFrameListView(FrameList *view, FrameList *pool) {
+    view->numFrames = 0;
+    view->capacity = pool->capacity;
+    view->head = NIL_FRAME;
+    view->tail = NIL_FRAME;
+    view->freeList = NIL_FRAME;
+    view->frames = pool->frames;
+}
+
+// Función para tomar un frame libre (NIL_FRAME si ya se usaron todos)
+static inline uint32_t createFrame(FrameList *frameList) {
+    uint32_t frame = frameList->freeList;
+    if (frame != NIL_FRAME) {
+        Frame *f = frameAt(frameList, frame);
+        frameList->freeList = f->next;
+        f->page = NO_PAGE;  // Inicialmente no hay página asignada
+        f->prev = NIL_FRAME;
+        f->next = NIL_FRAME;
+        f->frequency = 0;
+        f->valid = false;
+        f->referenced = false;
+    }
+    return frame;
+}
+
+// Función para devolver un frame (ya desenlazado) a la lista de libres
+static inline void freeFrame(FrameList *frameList, uint32_t frame) {
+    Frame *f = frameAt(frameList, frame);
+    f->page = NO_PAGE;
+    f->valid = false;
+    f->next = frameList->freeList;
+    frameList->freeList = frame;
+}
+
+// Función para insertar un frame al frente de la lista
+static inline void insertFrame(FrameList *frameList, uint32_t frame) {
+    Frame *f = frameAt(frameList, frame);
+    f->prev = NIL_FRAME;
+    f->next = frameList->head;
+    if (frameList->head != NIL_FRAME) {
+        frameAt(frameList, frameList->head)->prev = frame;
+    } else {
+        frameList->tail = frame; // Lista vacía
+    }
+    frameList->head = frame;
+    frameList->numFrames++;
+}
+
+// Función para insertar un frame al final de la lista
+static inline void appendFrame(FrameList *frameList, uint32_t frame) {
+    Frame *f = frameAt(frameList, frame);
+    f->next = NIL_FRAME;
+    f->prev = frameList->tail;
+    if (frameList->tail != NIL_FRAME) {
+        frameAt(frameList, frameList->tail)->next = frame;
+    } else {
+        frameList->head = frame; // Lista vacía
+    }
+    frameList->tail = frame;
+    frameList->numFrames++;
+}
+
+// Función para desenlazar un frame de la lista sin liberarlo
+static inline void unlinkFrame(FrameList *frameList, uint32_t frame) {
+    Frame *f = frameAt(frameList, frame);
+    if (f->prev != NIL_FRAME) {
+        frameAt(frameList, f->prev)->next = f->next;
+    } else {
+        frameList->head = f->next;
+    }
+    if (f->next != NIL_FRAME) {
+        frameAt(frameList, f->next)->prev = f->prev;
+    } else {
+        frameList->tail = f->prev;
+    }
+    f->prev = NIL_FRAME;
+    f->next = NIL_FRAME;
+    frameList->numFrames--;
+}
+
+// Función para mover un frame al frente de la lista (más recientemente usado)
+static inline void moveToFront(FrameList *frameList, uint32_t frame) {
+    if (frame == frameList->head) {
+        return; // Ya está al frente
+    }
+    unlinkFrame(frameList, frame);
+    insertFrame(frameList, frame);
+}
+
+// Función para eliminar un frame de la lista y devolverlo a la lista de libres
+static inline void removeFrame(FrameList *frameList, uint32_t frame) {
+    unlinkFrame(frameList, frame);
+    freeFrame(frameList, frame);
+}
+
+// Función para buscar un frame específico por número de página (recorrido lineal)
+static inline uint32_t findFrame(FrameList *frameList, PageId page) {
+    for (uint32_t current = frameList->head; current != NIL_FRAME; current = frameAt(frameList, current)->next) {
+        if (frameAt(frameList, current)->page == page) {
+            return current;
+        }
+    }
+    return NIL_FRAME;
+}
+
+// Función para liberar la lista junto con su arreglo de frames
+static inline void destroyFrameList(FrameList *frameList) {
+    if (frameList != NULL) {
+        free(frameList->frames);
+        free(frameList);
+    }
+}
+
+// Función para imprimir el estado actual de la lista de frames (solo para fines de depuración)
+static inline void printFrameList(FrameList *frameList) {
+    printf("Estado actual de la lista de frames:\n");
+    for (uint32_t current = frameList->head; current != NIL_FRAME; current = frameAt(frameList, current)->next) {
+        Frame *f = frameAt(frameList, current);
+        printf("Página: %lld, ", (long long)f->page);
+        if (f->valid) {
+            printf("Estado: Ocupado\n");
+        } else {
+            printf("Estado: Vacío\n");
+        }
+    }
+    printf("\n");
+}
+
+#endif
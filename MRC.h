@@ -0,0 +1,222 @@
+#ifndef MRC_H
+#define MRC_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "FRAME_LIST.h"
+#include "PAGE_INDEX.h"
+
+// Curva de tasa de fallos (miss ratio curve) de LRU con el algoritmo de Mattson:
+// la distancia de pila de un acceso es el número de páginas distintas referenciadas desde el
+// acceso anterior a la misma página (más uno). Con LRU y C frames el acceso es un acierto si y
+// solo si su distancia es <= C, así que un histograma de distancias da la tasa de fallos para
+// todos los tamaños de memoria en una sola pasada.
+//
+// Las distancias se cuentan con un árbol de Fenwick indexado por tiempo que tiene un 1 en el
+// instante del último acceso de cada página. Cuando el tiempo llega al final del árbol, los
+// últimos accesos se renumeran de forma compacta (0..D-1) y el árbol se reconstruye.
+
+#define MRC_INITIAL_WINDOW (1 << 16)   // Tamaño inicial del árbol de Fenwick
+
+// Estado del cálculo de distancias de pila
+typedef struct StackDistance {
+    int32_t *tree;          // Árbol de Fenwick (base 1) con las marcas de último acceso
+    uint32_t window;        // Número de instantes que caben en el árbol
+    uint32_t now;           // Siguiente instante a asignar
+    PageIndex *lastAccess;  // Índice página -> instante de su último acceso
+    uint64_t *histogram;    // histogram[d] = accesos con distancia de pila d (d >= 1)
+    uint64_t maxDistance;   // Mayor distancia observada
+    uint64_t histogramSize; // Tamaño reservado del histograma
+    uint64_t coldMisses;    // Primeros accesos a cada página (fallos obligatorios)
+    uint64_t accesses;      // Número total de accesos
+} StackDistance;
+
+// Estructura auxiliar para la compactación (instante del último acceso y página)
+typedef struct TimedPage {
+    uint32_t time;
+    int64_t page;
+} TimedPage;
+
+// Función para crear el estado del cálculo de distancias de pila
+static inline StackDistance* createStackDistance() {
+    StackDistance *sd = (StackDistance *)calloc(1, sizeof(StackDistance));
+    if (sd == NULL) {
+        return NULL;
+    }
+    sd->window = MRC_INITIAL_WINDOW;
+    sd->tree = (int32_t *)calloc((size_t)sd->window + 1, sizeof(int32_t));
+    sd->lastAccess = createPageIndex(1024);
+    sd->histogramSize = 1024;
+    sd->histogram = (uint64_t *)calloc(sd->histogramSize, sizeof(uint64_t));
+    if (sd->tree == NULL || sd->lastAccess == NULL || sd->histogram == NULL) {
+        free(sd->tree);
+        destroyPageIndex(sd->lastAccess);
+        free(sd->histogram);
+        free(sd);
+        return NULL;
+    }
+    return sd;
+}
+
+// Función para liberar el estado del cálculo de distancias de pila
+static inline void destroyStackDistance(StackDistance *sd) {
+    if (sd != NULL) {
+        free(sd->tree);
+        destroyPageIndex(sd->lastAccess);
+        free(sd->histogram);
+        free(sd);
+    }
+}
+
+// Función para sumar 'delta' en la posición 'pos' (base 0) del árbol de Fenwick
+static inline void fenwickAdd(StackDistance *sd, uint32_t pos, int32_t delta) {
+    for (uint32_t i = pos + 1; i <= sd->window; i += i & (~i + 1)) {
+        sd->tree[i] += delta;
+    }
+}
+
+// Función para contar las marcas en las posiciones [0, pos] del árbol de Fenwick
+static inline int64_t fenwickPrefix(StackDistance *sd, uint32_t pos) {
+    int64_t sum = 0;
+    for (uint32_t i = pos + 1; i > 0; i -= i & (~i + 1)) {
+        sum += sd->tree[i];
+    }
+    return sum;
+}
+
+// Función para ordenar las páginas por instante de último acceso
+static int compareTimedPages(const void *a, const void *b) {
+    uint32_t ta = ((const TimedPage *)a)->time;
+    uint32_t tb = ((const TimedPage *)b)->time;
+    return (ta > tb) - (ta < tb);
+}
+
+// Función para renumerar los últimos accesos como 0..D-1 y reconstruir el árbol
+// (la ventana se agranda para que siempre quede al menos la mitad libre)
+static inline bool compactStackDistance(StackDistance *sd) {
+    PageIndex *index = sd->lastAccess;
+    uint64_t distinct = index->count;
+    TimedPage *live = (TimedPage *)malloc((distinct > 0 ? distinct : 1) * sizeof(TimedPage));
+    if (live == NULL) {
+        return false;
+    }
+    uint64_t n = 0;
+    for (uint64_t i = 0; i <= index->mask; ++i) {
+        if (index->entries[i].page != EMPTY_PAGE) {
+            live[n].time = (uint32_t)index->entries[i].value;
+            live[n].page = index->entries[i].page;
+            n++;
+        }
+    }
+    qsort(live, n, sizeof(TimedPage), compareTimedPages);
+
+    uint64_t window = sd->window;
+    while (window < 2 * distinct) {
+        window *= 2;
+    }
+    if (window > UINT32_MAX / 2) {
+        free(live);
+        return false;
+    }
+    if (window != sd->window) {
+        int32_t *tree = (int32_t *)realloc(sd->tree, ((size_t)window + 1) * sizeof(int32_t));
+        if (tree == NULL) {
+            free(live);
+            return false;
+        }
+        sd->tree = tree;
+        sd->window = (uint32_t)window;
+    }
+
+    // Reconstruir en O(ventana): un 1 en cada posición 0..D-1
+    for (uint32_t i = 1; i <= sd->window; ++i) {
+        sd->tree[i] = i <= n ? 1 : 0;
+    }
+    for (uint32_t i = 1; i <= sd->window; ++i) {
+        uint32_t parent = i + (i & (~i + 1));
+        if (parent <= sd->window) {
+            sd->tree[parent] += sd->tree[i];
+        }
+    }
+    for (uint64_t i = 0; i < n; ++i) {
+        *indexFind(index, live[i].page) = i;
+    }
+    sd->now = (uint32_t)n;
+    free(live);
+    return true;
+}
+
+// Función para registrar una distancia de pila en el histograma
+static inline bool recordDistance(StackDistance *sd, uint64_t distance) {
+    if (distance >= sd->histogramSize) {
+        uint64_t size = sd->histogramSize;
+        while (size <= distance) {
+            size *= 2;
+        }
+        uint64_t *histogram = (uint64_t *)realloc(sd->histogram, size * sizeof(uint64_t));
+        if (histogram == NULL) {
+            return false;
+        }
+        for (uint64_t i = sd->histogramSize; i < size; ++i) {
+            histogram[i] = 0;
+        }
+        sd->histogram = histogram;
+        sd->histogramSize = size;
+    }
+    sd->histogram[distance]++;
+    if (distance > sd->maxDistance) {
+        sd->maxDistance = distance;
+    }
+    return true;
+}
+
+// Función para procesar un acceso a una página; devuelve false si no hubo memoria suficiente
+static inline bool stackDistanceAccess(StackDistance *sd, PageId page) {
+    if (sd->now == sd->window && !compactStackDistance(sd)) {
+        return false;
+    }
+
+    uint32_t now = sd->now++;
+    uint64_t *last = indexFind(sd->lastAccess, page);
+    sd->accesses++;
+    if (last == NULL) {
+        sd->coldMisses++;
+        fenwickAdd(sd, now, 1);
+        return indexInsert(sd->lastAccess, page, now);
+    }
+
+    // Páginas distintas accedidas después del último acceso a esta página
+    uint32_t previous = (uint32_t)*last;
+    uint64_t between = (uint64_t)(fenwickPrefix(sd, now - 1) - fenwickPrefix(sd, previous));
+    fenwickAdd(sd, previous, -1);
+    fenwickAdd(sd, now, 1);
+    *last = now;
+    return recordDistance(sd, between + 1);
+}
+
+// Función para imprimir la curva de tasa de fallos para 1..maxFrames frames
+// (maxFrames = 0 imprime hasta el tamaño a partir del cual solo quedan fallos obligatorios)
+static inline void printMissRatioCurve(StackDistance *sd, uint64_t maxFrames) {
+    if (maxFrames == 0) {
+        maxFrames = sd->maxDistance > 0 ? sd->maxDistance : 1;
+    }
+
+    // Fallos con C frames = obligatorios + accesos con distancia > C
+    uint64_t misses = sd->coldMisses;
+    for (uint64_t d = 2; d <= sd->maxDistance; ++d) {
+        misses += sd->histogram[d];
+    }
+
+    printf("%10s %14s %12s\n", "Frames", "Fallos", "Tasa fallos");
+    for (uint64_t frames = 1; frames <= maxFrames; ++frames) {
+        printf("%10llu %14llu %11.4f%%\n", (unsigned long long)frames, (unsigned long long)misses,
+               sd->accesses > 0 ? 100.0 * misses / sd->accesses : 0.0);
+        if (frames + 1 <= sd->maxDistance) {
+            misses -= sd->histogram[frames + 1];
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,780 @@
+#ifndef ORACLE_H
+#define ORACLE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "POLICIES.h"
+#include "POLICY_LOOKAHEAD.h"
+
+// Modelos de referencia de las políticas: arreglos pequeños recorridos linealmente,
+// escritos para ser obviamente correctos y no rápidos. Sirven para comparar acceso por acceso
+// los aciertos y fallos de las implementaciones de la biblioteca con trazas aleatorias. Una
+// segunda pasada intercala al azar remove y evict entre los accesos (como hacen la jerarquía de
+// niveles y el reparto entre procesos): en FIFO, LRU, LFU, OPT y OPT con ventana la víctima de
+// evict debe ser la del modelo, y en el resto solo se verifica qué páginas quedan cargadas.
+
+#define ORACLE_MAX_FRAMES 16   // Número máximo de frames de los modelos de referencia
+
+// Estado de un modelo de referencia
+typedef struct OracleModel {
+    PageId pages[ORACLE_MAX_FRAMES];      // Páginas cargadas (el orden depende de la política)
+    int frequency[ORACLE_MAX_FRAMES];     // Frecuencia de acceso de cada página (LFU)
+    bool referenced[ORACLE_MAX_FRAMES];   // Bit de referencia de cada frame (Clock)
+    int size;                             // Número de páginas cargadas
+    int capacity;                         // Número máximo de páginas
+    int hand;                             // Manecilla del reloj (Clock)
+    PageId lists[4][3 * ORACLE_MAX_FRAMES + 1]; // Listas de ARC, 2Q y LIRS (posición 0 = la más antigua)
+    int listSize[4];                      // Tamaño de cada lista
+    int target;                           // Tamaño objetivo de T1 (ARC) o de las frías (CLOCK-Pro)
+    int ringInfo[3 * ORACLE_MAX_FRAMES + 1]; // Tipo * 2 + bit de referencia de cada posición del anillo (CLOCK-Pro)
+    int hands[3];                         // Posiciones de hand hot, cold y test (CLOCK-Pro)
+} OracleModel;
+
+// Función para buscar una página en el modelo (-1 si no está)
+static inline int oracleFind(OracleModel *m, PageId page) {
+    for (int i = 0; i < m->size; ++i) {
+        if (m->pages[i] == page) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Función para quitar la posición 'pos' del modelo desplazando el resto
+static inline void oracleRemoveAt(OracleModel *m, int pos) {
+    for (int i = pos; i + 1 < m->size; ++i) {
+        m->pages[i] = m->pages[i + 1];
+        m->frequency[i] = m->frequency[i + 1];
+        m->referenced[i] = m->referenced[i + 1];
+    }
+    m->size--;
+}
+
+// Función para agregar una página al final del modelo
+static inline void oracleAppend(OracleModel *m, PageId page) {
+    m->pages[m->size] = page;
+    m->frequency[m->size] = 1;
+    m->referenced[m->size] = false;
+    m->size++;
+}
+
+// FIFO: las páginas se guardan en orden de llegada y se expulsa la primera
+static inline bool fifoOracle(OracleModel *m, const PageId *trace, size_t pos, size_t length) {
+    (void)length;
+    if (oracleFind(m, trace[pos]) >= 0) {
+        return true;
+    }
+    if (m->size == m->capacity) {
+        oracleRemoveAt(m, 0);
+    }
+    oracleAppend(m, trace[pos]);
+    return false;
+}
+
+// LRU: las páginas se guardan de la menos a la más recientemente usada
+static inline bool lruOracle(OracleModel *m, const PageId *trace, size_t pos, size_t length) {
+    (void)length;
+    int found = oracleFind(m, trace[pos]);
+    if (found >= 0) {
+        oracleRemoveAt(m, found);
+        oracleAppend(m, trace[pos]);
+        return true;
+    }
+    if (m->size == m->capacity) {
+        oracleRemoveAt(m, 0);
+    }
+    oracleAppend(m, trace[pos]);
+    return false;
+}
+
+// Clock: frames en un anillo fijo; la manecilla limpia bits de referencia hasta encontrar uno en 0,
+// reemplaza esa página (que entra sin bit de referencia) y avanza
+static inline bool clockOracle(OracleModel *m, const PageId *trace, size_t pos, size_t length) {
+    (void)length;
+    int found = oracleFind(m, trace[pos]);
+    if (found >= 0) {
+        m->referenced[found] = true;
+        return true;
+    }
+    if (m->size < m->capacity) {
+        oracleAppend(m, trace[pos]);
+        return false;
+    }
+    while (m->referenced[m->hand]) {
+        m->referenced[m->hand] = false;
+        m->hand = (m->hand + 1) % m->capacity;
+    }
+    m->pages[m->hand] = trace[pos];
+    m->referenced[m->hand] = false;
+    m->hand = (m->hand + 1) % m->capacity;
+    return false;
+}
+
+// LFU: se expulsa la página con menor frecuencia; los empates se resuelven por LRU
+// (las páginas se guardan de la menos a la más recientemente usada, como en lruOracle)
+static inline bool lfuOracle(OracleModel *m, const PageId *trace, size_t pos, size_t length) {
+    (void)length;
+    int found = oracleFind(m, trace[pos]);
+    if (found >= 0) {
+        int frequency = m->frequency[found] + 1;
+        oracleRemoveAt(m, found);
+        oracleAppend(m, trace[pos]);
+        m->frequency[m->size - 1] = frequency;
+        return true;
+    }
+    if (m->size == m->capacity) {
+        int victim = 0;
+        for (int i = 1; i < m->size; ++i) {
+            if (m->frequency[i] < m->frequency[victim]) {
+                victim = i;
+            }
+        }
+        oracleRemoveAt(m, victim);
+    }
+    oracleAppend(m, trace[pos]);
+    return false;
+}
+
+// GCLOCK: como Clock pero con un contador de referencias (hasta GCLOCK_MAX_COUNT) que la manecilla
+// decrementa en cada pasada
+static inline bool gclockOracle(OracleModel *m, const PageId *trace, size_t pos, size_t length) {
+    (void)length;
+    int found = oracleFind(m, trace[pos]);
+    if (found >= 0) {
+        if (m->frequency[found] < GCLOCK_MAX_COUNT) {
+            m->frequency[found]++;
+        }
+        return true;
+    }
+    if (m->size < m->capacity) {
+        oracleAppend(m, trace[pos]);
+        m->frequency[m->size - 1] = 0;
+        return false;
+    }
+    while (m->frequency[m->hand] > 0) {
+        m->frequency[m->hand]--;
+        m->hand = (m->hand + 1) % m->capacity;
+    }
+    m->pages[m->hand] = trace[pos];
+    m->frequency[m->hand] = 0;
+    m->hand = (m->hand + 1) % m->capacity;
+    return false;
+}
+
+// OPT: se expulsa la página cuyo próximo uso está más lejos (buscándolo en el resto de la traza)
+static inline bool optOracle(OracleModel *m, const PageId *trace, size_t pos, size_t length) {
+    if (oracleFind(m, trace[pos]) >= 0) {
+        return true;
+    }
+    if (m->size == m->capacity) {
+        int victim = 0;
+        size_t farthest = 0;
+        for (int i = 0; i < m->size; ++i) {
+            size_t next = pos + 1;
+            while (next < length && trace[next] != m->pages[i]) {
+                next++;
+            }
+            if (next > farthest) {
+                farthest = next;
+                victim = i;
+            }
+        }
+        oracleRemoveAt(m, victim);
+    }
+    oracleAppend(m, trace[pos]);
+    return false;
+}
+
+// Función para buscar una página en una lista del modelo (-1 si no está)
+static inline int oracleListFind(OracleModel *m, int list, PageId page) {
+    for (int i = 0; i < m->listSize[list]; ++i) {
+        if (m->lists[list][i] == page) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Función para quitar la posición 'pos' de una lista y devolver su página
+static inline PageId oracleListRemove(OracleModel *m, int list, int pos) {
+    PageId page = m->lists[list][pos];
+    for (int i = pos; i + 1 < m->listSize[list]; ++i) {
+        m->lists[list][i] = m->lists[list][i + 1];
+    }
+    m->listSize[list]--;
+    return page;
+}
+
+// Función para agregar una página como la más reciente de una lista
+static inline void oracleListPush(OracleModel *m, int list, PageId page) {
+    m->lists[list][m->listSize[list]++] = page;
+}
+
+// REPLACE de ARC: pasa el LRU de T1 (lista 0) a B1 (lista 2) o el de T2 (lista 1) a B2 (lista 3)
+static inline void arcOracleReplace(OracleModel *m, bool inB2) {
+    int t1 = m->listSize[0];
+    if (t1 > 0 && (t1 > m->target || (inB2 && t1 == m->target) || m->listSize[1] == 0)) {
+        oracleListPush(m, 2, oracleListRemove(m, 0, 0));
+    } else {
+        oracleListPush(m, 3, oracleListRemove(m, 1, 0));
+    }
+}
+
+// ARC: transcripción directa del algoritmo de Megiddo y Modha sobre cuatro arreglos
+static inline bool arcOracle(OracleModel *m, const PageId *trace, size_t pos, size_t length) {
+    (void)length;
+    PageId page = trace[pos];
+    int c = m->capacity;
+    bool full = m->listSize[0] + m->listSize[1] == c;
+    for (int list = 0; list < 2; ++list) {
+        int found = oracleListFind(m, list, page);
+        if (found >= 0) {
+            oracleListRemove(m, list, found);
+            oracleListPush(m, 1, page);
+            return true;
+        }
+    }
+    int b1 = m->listSize[2];
+    int b2 = m->listSize[3];
+    int found = oracleListFind(m, 2, page);
+    if (found >= 0) {
+        m->target += b1 >= b2 ? 1 : b2 / b1;
+        if (m->target > c) m->target = c;
+        if (full) arcOracleReplace(m, false);
+        oracleListRemove(m, 2, oracleListFind(m, 2, page));
+        oracleListPush(m, 1, page);
+        return false;
+    }
+    found = oracleListFind(m, 3, page);
+    if (found >= 0) {
+        m->target -= b2 >= b1 ? 1 : b1 / b2;
+        if (m->target < 0) m->target = 0;
+        if (full) arcOracleReplace(m, true);
+        oracleListRemove(m, 3, oracleListFind(m, 3, page));
+        oracleListPush(m, 1, page);
+        return false;
+    }
+
+    int l1 = m->listSize[0] + m->listSize[2];
+    int total = l1 + m->listSize[1] + m->listSize[3];
+    if (l1 == c) {
+        if (m->listSize[0] < c) {
+            oracleListRemove(m, 2, 0);
+            if (full) arcOracleReplace(m, false);
+        } else {
+            oracleListRemove(m, 0, 0);
+        }
+    } else if (total >= c) {
+        if (total == 2 * c) oracleListRemove(m, 3, 0);
+        if (full) arcOracleReplace(m, false);
+    }
+    oracleListPush(m, 0, page);
+    return false;
+}
+
+// 2Q: A1in (lista 0) y A1out (lista 2) son colas FIFO y Am (lista 1) es LRU
+static inline bool twoQOracle(OracleModel *m, const PageId *trace, size_t pos, size_t length) {
+    (void)length;
+    PageId page = trace[pos];
+    int c = m->capacity;
+    int inLimit = c / 4 > 0 ? c / 4 : 1;
+    int outLimit = c / 2 > 0 ? c / 2 : 1;
+    int found = oracleListFind(m, 1, page);
+    if (found >= 0) {
+        oracleListRemove(m, 1, found);
+        oracleListPush(m, 1, page);
+        return true;
+    }
+    if (oracleListFind(m, 0, page) >= 0) {
+        return true;
+    }
+    found = oracleListFind(m, 2, page);
+    if (found >= 0) {
+        oracleListRemove(m, 2, found);
+    }
+    if (m->listSize[0] + m->listSize[1] == c) {
+        if (m->listSize[0] > inLimit || m->listSize[1] == 0) {
+            if (m->listSize[2] == outLimit) oracleListRemove(m, 2, 0);
+            oracleListPush(m, 2, oracleListRemove(m, 0, 0));
+        } else {
+            oracleListRemove(m, 1, 0);
+        }
+    }
+    oracleListPush(m, found >= 0 ? 1 : 0, page);
+    return false;
+}
+
+// Poda de LIRS: quita del fondo de S (lista 0) las páginas que no son LIR (lista 2); los
+// fantasmas (lista 3) se olvidan
+static inline void lirsOraclePrune(OracleModel *m) {
+    while (m->listSize[0] > 0 && oracleListFind(m, 2, m->lists[0][0]) < 0) {
+        PageId page = oracleListRemove(m, 0, 0);
+        int ghost = oracleListFind(m, 3, page);
+        if (ghost >= 0) oracleListRemove(m, 3, ghost);
+    }
+}
+
+// LIRS: número máximo de páginas LIR (todos los frames menos el 1%, y al menos uno)
+static inline int lirsOracleLirLimit(OracleModel *m) {
+    int c = m->capacity;
+    int hirLimit = c / 100 > 0 ? c / 100 : 1;
+    return c - hirLimit > 0 ? c - hirLimit : 1;
+}
+
+// LIRS: convierte en LIR una página que ya está en el tope de S y, si sobran LIR, pasa la del
+// fondo de S al final de Q (lista 1)
+static inline void lirsOraclePromote(OracleModel *m, PageId page) {
+    oracleListPush(m, 2, page);
+    if (m->listSize[2] > lirsOracleLirLimit(m)) {
+        PageId bottom = oracleListRemove(m, 0, 0);
+        oracleListRemove(m, 2, oracleListFind(m, 2, bottom));
+        oracleListPush(m, 1, bottom);
+        lirsOraclePrune(m);
+    }
+}
+
+// LIRS: pila S (lista 0, posición 0 = fondo), cola Q de HIR residentes (lista 1), conjunto de
+// páginas LIR (lista 2) y fantasmas en orden de expulsión (lista 3, como máximo 2 * capacity)
+static inline bool lirsOracle(OracleModel *m, const PageId *trace, size_t pos, size_t length) {
+    (void)length;
+    PageId page = trace[pos];
+    int c = m->capacity;
+    int inStack = oracleListFind(m, 0, page);
+    if (oracleListFind(m, 2, page) >= 0) {
+        oracleListRemove(m, 0, inStack);
+        oracleListPush(m, 0, page);
+        lirsOraclePrune(m);
+        return true;
+    }
+    int inQueue = oracleListFind(m, 1, page);
+    if (inQueue >= 0) {
+        oracleListRemove(m, 1, inQueue);
+        if (inStack >= 0) {
+            oracleListRemove(m, 0, inStack);
+            oracleListPush(m, 0, page);
+            lirsOraclePromote(m, page);
+        } else {
+            oracleListPush(m, 0, page);
+            oracleListPush(m, 1, page);
+        }
+        return true;
+    }
+
+    if (m->listSize[2] + m->listSize[1] == c) {
+        PageId evicted;
+        if (m->listSize[1] > 0) {
+            evicted = oracleListRemove(m, 1, 0);
+        } else {
+            evicted = oracleListRemove(m, 0, 0);
+            oracleListRemove(m, 2, oracleListFind(m, 2, evicted));
+            lirsOraclePrune(m);
+        }
+        if (oracleListFind(m, 0, evicted) >= 0) {
+            oracleListPush(m, 3, evicted);
+            if (m->listSize[3] > 2 * c) {
+                PageId oldest = oracleListRemove(m, 3, 0);
+                oracleListRemove(m, 0, oracleListFind(m, 0, oldest));
+            }
+        }
+    }
+    inStack = oracleListFind(m, 0, page);
+    if (inStack >= 0) {
+        oracleListRemove(m, 3, oracleListFind(m, 3, page));
+        oracleListRemove(m, 0, inStack);
+        oracleListPush(m, 0, page);
+        lirsOraclePromote(m, page);
+        return false;
+    }
+    oracleListPush(m, 0, page);
+    if (m->listSize[2] < lirsOracleLirLimit(m)) {
+        oracleListPush(m, 2, page);
+    } else {
+        oracleListPush(m, 1, page);
+    }
+    return false;
+}
+
+// CLOCK-Pro: el anillo es la lista 0 (la posición siguiente a la última es la 0), con el tipo y el
+// bit de referencia de cada posición en ringInfo y las manecillas como posiciones
+static inline int clockProOracleType(OracleModel *m, int pos) {
+    return m->ringInfo[pos] / 2;
+}
+
+// Función para contar las posiciones del anillo de un tipo
+static inline int clockProOracleCount(OracleModel *m, int type) {
+    int count = 0;
+    for (int i = 0; i < m->listSize[0]; ++i) {
+        count += clockProOracleType(m, i) == type;
+    }
+    return count;
+}
+
+// Función para insertar una página justo antes de hand hot
+static inline void clockProOracleInsert(OracleModel *m, PageId page, int type) {
+    int n = m->listSize[0];
+    if (n == 0) {
+        m->lists[0][0] = page;
+        m->ringInfo[0] = type * 2;
+        m->listSize[0] = 1;
+        m->hands[0] = m->hands[1] = m->hands[2] = 0;
+        return;
+    }
+    int at = m->hands[0];
+    for (int i = n; i > at; --i) {
+        m->lists[0][i] = m->lists[0][i - 1];
+        m->ringInfo[i] = m->ringInfo[i - 1];
+    }
+    m->lists[0][at] = page;
+    m->ringInfo[at] = type * 2;
+    m->listSize[0]++;
+    for (int h = 0; h < 3; ++h) {
+        if (m->hands[h] >= at) m->hands[h]++;
+    }
+}
+
+// Función para quitar una posición del anillo; las manecillas que la señalan pasan a la anterior
+static inline void clockProOracleRemove(OracleModel *m, int at) {
+    int n = m->listSize[0];
+    for (int h = 0; h < 3; ++h) {
+        if (m->hands[h] == at) m->hands[h] = (at + n - 1) % n;
+        if (m->hands[h] > at) m->hands[h]--;
+    }
+    for (int i = at; i + 1 < n; ++i) {
+        m->lists[0][i] = m->lists[0][i + 1];
+        m->ringInfo[i] = m->ringInfo[i + 1];
+    }
+    m->listSize[0]--;
+}
+
+// Límites del objetivo de las frías: el mínimo y capacity menos el mínimo (como en clockProInit)
+static inline int clockProOracleColdMin(OracleModel *m) {
+    return m->capacity * CLOCKPRO_MIN_PERCENT / 100 > 1 ? m->capacity * CLOCKPRO_MIN_PERCENT / 100 : 1;
+}
+
+static inline int clockProOracleColdMax(OracleModel *m) {
+    int coldMin = clockProOracleColdMin(m);
+    return m->capacity - coldMin > coldMin ? m->capacity - coldMin : coldMin;
+}
+
+// Función para terminar el periodo de prueba de la página en la posición 'at'
+static inline void clockProOracleExpire(OracleModel *m, int at) {
+    clockProOracleRemove(m, at);
+    if (m->target > clockProOracleColdMin(m)) m->target--;
+}
+
+// hand test: olvida la página en prueba que señala
+static inline void clockProOracleHandTest(OracleModel *m) {
+    if (clockProOracleType(m, m->hands[2]) == CLOCKPRO_TEST) clockProOracleExpire(m, m->hands[2]);
+    m->hands[2] = (m->hands[2] + 1) % m->listSize[0];
+}
+
+// hand hot: quita el bit de referencia o convierte en fría a la caliente que señala y olvida a
+// la página en prueba que encuentre
+static inline void clockProOracleHandHot(OracleModel *m) {
+    int at = m->hands[0];
+    if (m->ringInfo[at] == CLOCKPRO_HOT * 2 + 1) {
+        m->ringInfo[at] = CLOCKPRO_HOT * 2;
+    } else if (m->ringInfo[at] == CLOCKPRO_HOT * 2) {
+        m->ringInfo[at] = CLOCKPRO_COLD * 2;
+    } else if (clockProOracleType(m, at) == CLOCKPRO_TEST) {
+        clockProOracleExpire(m, at);
+    }
+    m->hands[0] = (m->hands[0] + 1) % m->listSize[0];
+}
+
+// hand cold: la fría con referencia pasa a caliente y la fría sin referencia queda en prueba
+static inline void clockProOracleHandCold(OracleModel *m) {
+    int at = m->hands[1];
+    if (m->ringInfo[at] == CLOCKPRO_COLD * 2 + 1) {
+        m->ringInfo[at] = CLOCKPRO_HOT * 2;
+    } else if (m->ringInfo[at] == CLOCKPRO_COLD * 2) {
+        m->ringInfo[at] = CLOCKPRO_TEST * 2;
+    }
+    m->hands[1] = (at + 1) % m->listSize[0];
+}
+
+// CLOCK-Pro (versión simplificada): transcripción sobre un arreglo circular
+static inline bool clockProOracle(OracleModel *m, const PageId *trace, size_t pos, size_t length) {
+    (void)length;
+    PageId page = trace[pos];
+    if (pos == 0) m->target = clockProOracleColdMax(m);
+    int found = oracleListFind(m, 0, page);
+    int type = CLOCKPRO_COLD;
+    if (found >= 0) {
+        if (clockProOracleType(m, found) != CLOCKPRO_TEST) {
+            m->ringInfo[found] |= 1;
+            return true;
+        }
+        if (m->target < clockProOracleColdMax(m)) m->target++;
+        clockProOracleRemove(m, found);
+        type = CLOCKPRO_HOT;
+    }
+    while (clockProOracleCount(m, CLOCKPRO_HOT) + clockProOracleCount(m, CLOCKPRO_COLD) >= m->capacity) {
+        clockProOracleHandCold(m);
+        while (clockProOracleCount(m, CLOCKPRO_TEST) > m->capacity) clockProOracleHandTest(m);
+        while (clockProOracleCount(m, CLOCKPRO_HOT) > m->capacity - m->target) clockProOracleHandHot(m);
+    }
+    clockProOracleInsert(m, page, type);
+    return false;
+}
+
+// Modelo de referencia asociado a una política de la biblioteca
+typedef struct Oracle {
+    const char *name;   // Nombre corto de la política
+    bool (*access)(OracleModel *m, const PageId *trace, size_t pos, size_t length);
+} Oracle;
+
+static const Oracle allOracles[] = {
+    {"fifo", fifoOracle},
+    {"lru", lruOracle},
+    {"clock", clockOracle},
+    {"gclock", gclockOracle},
+    {"lfu", lfuOracle},
+    {"opt", optOracle},
+    {"arc", arcOracle},
+    {"2q", twoQOracle},
+    {"lirs", lirsOracle},
+    {"clockpro", clockProOracle},
+};
+
+#define NUM_ORACLES ((int)(sizeof(allOracles) / sizeof(allOracles[0])))
+
+// Función para comparar una política con su modelo de referencia sobre una traza
+// Devuelve la posición del primer acceso en que difieren o 'length' si coinciden en todos
+static inline size_t compareWithOracle(const PolicyOps *ops, const Oracle *oracle, int capacity,
+                                       const PageId *trace, const uint32_t *nextUse, size_t length) {
+    OracleModel model;
+    memset(&model, 0, sizeof(model));
+    model.capacity = capacity;
+
+    Policy *policy = createPolicy(ops, capacity);
+    if (policy == NULL) {
+        return 0;
+    }
+    size_t pos = 0;
+    for (; pos < length; ++pos) {
+        uint64_t next = nextUse[pos] == NEVER32 ? NEVER : nextUse[pos];
+        bool hit = policyAccess(policy, trace[pos], next, NULL);
+        if (hit != oracle->access(&model, trace, pos, length)) {
+            break;
+        }
+    }
+    destroyPolicy(policy);
+    return pos;
+}
+
+// Víctima que debe elegir evict en la pasada con remove y evict intercalados
+enum OracleVictim {
+    VICTIM_ANY,         // Cualquier página cargada (solo se verifica qué páginas quedan cargadas)
+    VICTIM_FIRST,       // La primera del modelo (la más antigua en FIFO, la menos reciente en LRU)
+    VICTIM_LFU,         // La de menor frecuencia y, entre ellas, la menos reciente
+    VICTIM_FARTHEST     // Una de las que vuelven más tarde (OPT; los empates no importan)
+};
+
+// Política verificada con remove y evict intercalados
+typedef struct RemoveOracle {
+    const PolicyOps *ops;
+    bool (*access)(OracleModel *m, const PageId *trace, size_t pos, size_t length); // Solo con VICTIM_FIRST y VICTIM_LFU
+    int victim;         // Regla de la víctima de evict (enum OracleVictim)
+} RemoveOracle;
+
+static const RemoveOracle removeOracles[] = {
+    {&fifoPolicy, fifoOracle, VICTIM_FIRST},
+    {&lruPolicy, lruOracle, VICTIM_FIRST},
+    {&lfuPolicy, lfuOracle, VICTIM_LFU},
+    {&optPolicy, NULL, VICTIM_FARTHEST},
+    {&lookaheadPolicy, NULL, VICTIM_FARTHEST},   // Con todo el futuro a la vista es OPT
+    {&clockPolicy, NULL, VICTIM_ANY},
+    {&gclockPolicy, NULL, VICTIM_ANY},
+    {&arcPolicy, NULL, VICTIM_ANY},
+    {&twoQPolicy, NULL, VICTIM_ANY},
+    {&sampledLruPolicy, NULL, VICTIM_ANY},
+    {&clockProPolicy, NULL, VICTIM_ANY},
+};
+
+#define NUM_REMOVE_ORACLES ((int)(sizeof(removeOracles) / sizeof(removeOracles[0])))
+
+// Función para obtener la posición del próximo uso de una página desde 'from' ('length' si no vuelve)
+static inline size_t oracleNextUse(const PageId *trace, size_t from, size_t length, PageId page) {
+    while (from < length && trace[from] != page) {
+        from++;
+    }
+    return from;
+}
+
+// Función para elegir en el modelo la víctima de evict según la regla; el siguiente acceso es 'next'
+static inline int oracleVictim(OracleModel *m, int rule, const PageId *trace, size_t next, size_t length) {
+    int victim = 0;
+    for (int i = 1; i < m->size; ++i) {
+        if ((rule == VICTIM_LFU && m->frequency[i] < m->frequency[victim]) ||
+            (rule == VICTIM_FARTHEST && oracleNextUse(trace, next, length, m->pages[i]) >
+                                        oracleNextUse(trace, next, length, m->pages[victim]))) {
+            victim = i;
+        }
+    }
+    return victim;
+}
+
+// Función para comparar una política con su modelo intercalando al azar remove (de páginas de
+// [0, universe), cargadas o no) y evict entre los accesos de la traza. Devuelve el número de
+// accesos hechos antes de la primera diferencia o 'length' si coinciden en todo
+static inline size_t compareRemoveEvict(const RemoveOracle *oracle, int capacity, const PageId *trace,
+                                        const uint32_t *nextUse, size_t length, int universe, uint64_t *state) {
+    OracleModel model;
+    memset(&model, 0, sizeof(model));
+    model.capacity = capacity;
+
+    Policy *policy = createPolicy(oracle->ops, capacity);
+    if (policy == NULL) {
+        return 0;
+    }
+    size_t pos = 0;
+    bool ok = true;
+    while (ok && pos < length) {
+        uint64_t operation = nextRandom(state) % 16;
+        if (operation < 2) {
+            PageId page = (PageId)(nextRandom(state) % (uint64_t)universe);
+            int found = oracleFind(&model, page);
+            ok = policyRemove(policy, page) == (found >= 0);
+            if (found >= 0) {
+                oracleRemoveAt(&model, found);
+            }
+        } else if (operation == 2) {
+            PageId page = policyEvict(policy);
+            if (model.size == 0) {
+                ok = page == NO_PAGE;
+                continue;
+            }
+            int found = oracleFind(&model, page);
+            int expected = oracleVictim(&model, oracle->victim, trace, pos, length);
+            if (oracle->victim == VICTIM_FARTHEST) {
+                ok = found >= 0 && oracleNextUse(trace, pos, length, page) ==
+                                   oracleNextUse(trace, pos, length, model.pages[expected]);
+            } else {
+                ok = found >= 0 && (oracle->victim == VICTIM_ANY || found == expected);
+            }
+            if (found >= 0) {
+                oracleRemoveAt(&model, found);
+            }
+        } else {
+            uint64_t next = nextUse[pos] == NEVER32 ? NEVER : nextUse[pos];
+            PageId victim;
+            bool hit = policyAccess(policy, trace[pos], next, &victim);
+            if (oracle->access != NULL) {
+                ok = hit == oracle->access(&model, trace, pos, length);
+            } else {
+                // Un acierto debe ser una página cargada y un fallo solo expulsa si no queda lugar
+                // (con OPT una de las que vuelven más tarde: el modelo sigue a la política en los
+                // empates, que no cambian los aciertos)
+                bool full = model.size == capacity;
+                int found = oracleFind(&model, trace[pos]);
+                int evicted = victim != NO_PAGE ? oracleFind(&model, victim) : -1;
+                ok = hit == (found >= 0) && (hit || (full ? evicted >= 0 : victim == NO_PAGE));
+                if (ok && evicted >= 0 && oracle->victim == VICTIM_FARTHEST) {
+                    int expected = oracleVictim(&model, VICTIM_FARTHEST, trace, pos + 1, length);
+                    ok = oracleNextUse(trace, pos + 1, length, victim) ==
+                         oracleNextUse(trace, pos + 1, length, model.pages[expected]);
+                }
+                if (ok && !hit) {
+                    if (evicted >= 0) {
+                        oracleRemoveAt(&model, evicted);
+                    }
+                    oracleAppend(&model, trace[pos]);
+                }
+            }
+            if (ok) {
+                pos++;
+            }
+        }
+    }
+    destroyPolicy(policy);
+    return pos;
+}
+
+// Función para generar una traza aleatoria con su capacidad, su universo de páginas y sus
+// próximos usos (algunas con localidad); devuelve su longitud
+static inline size_t generateOracleTrace(uint64_t *state, PageId *trace, uint32_t *nextUse, size_t maxLength,
+                                         int *capacity, int *universe) {
+    *capacity = 1 + (int)(nextRandom(state) % ORACLE_MAX_FRAMES);
+    *universe = *capacity + 1 + (int)(nextRandom(state) % (uint64_t)(3 * *capacity));
+    size_t length = 1 + (size_t)(nextRandom(state) % maxLength);
+    bool local = nextRandom(state) % 2 == 0;
+    for (size_t p = 0; p < length; ++p) {
+        if (local && p > 0 && nextRandom(state) % 2 == 0) {
+            trace[p] = trace[(size_t)(nextRandom(state) % p)];
+        } else {
+            trace[p] = (PageId)(nextRandom(state) % (uint64_t)*universe);
+        }
+    }
+    computeNextUse(trace, (uint32_t)length, nextUse);
+    return length;
+}
+
+// Función para verificar todas las políticas que tienen modelo de referencia con trazas aleatorias,
+// primero solo con accesos y después con remove y evict intercalados
+// Devuelve true si no hubo ninguna diferencia
+static inline bool verifyPolicies(uint64_t seed, int numTraces) {
+    const size_t maxLength = 2000;
+    PageId *trace = (PageId *)malloc(maxLength * sizeof(PageId));
+    uint32_t *nextUse = (uint32_t *)malloc(maxLength * sizeof(uint32_t));
+    if (trace == NULL || nextUse == NULL) {
+        free(trace);
+        free(nextUse);
+        return false;
+    }
+
+    bool ok = true;
+    uint64_t state = seed != 0 ? seed : 1;
+    for (int i = 0; i < NUM_ORACLES; ++i) {
+        const PolicyOps *ops = findPolicy(allOracles[i].name);
+        int failures = 0;
+        uint64_t traceState = state;
+        for (int t = 0; t < numTraces && ops != NULL; ++t) {
+            // Trazas con distinta capacidad, tamaño de universo y longitud (algunas con localidad)
+            uint64_t traceSeed = traceState;
+            int capacity, universe;
+            size_t length = generateOracleTrace(&traceState, trace, nextUse, maxLength, &capacity, &universe);
+            size_t diff = compareWithOracle(ops, &allOracles[i], capacity, trace, nextUse, length);
+            if (diff != length) {
+                if (failures++ == 0) {
+                    printf("%s: difiere del modelo de referencia en el acceso %zu (traza %d, semilla %llu, %d frames)\n",
+                           ops->name, diff, t, (unsigned long long)traceSeed, capacity);
+                }
+                ok = false;
+            }
+        }
+        if (ops != NULL) {
+            printf("%-10s %d/%d trazas coinciden\n", ops->name, numTraces - failures, numTraces);
+        }
+    }
+
+    for (int i = 0; i < NUM_REMOVE_ORACLES; ++i) {
+        const RemoveOracle *oracle = &removeOracles[i];
+        int failures = 0;
+        uint64_t traceState = state;
+        for (int t = 0; t < numTraces; ++t) {
+            uint64_t traceSeed = traceState;
+            int capacity, universe;
+            size_t length = generateOracleTrace(&traceState, trace, nextUse, maxLength, &capacity, &universe);
+            uint64_t operations = traceSeed ^ 0x9E3779B97F4A7C15ULL; // Sorteo de remove y evict
+            size_t diff = compareRemoveEvict(oracle, capacity, trace, nextUse, length, universe, &operations);
+            if (diff != length) {
+                if (failures++ == 0) {
+                    printf("%s: difiere del modelo con remove y evict antes del acceso %zu (traza %d, semilla %llu, %d frames)\n",
+                           oracle->ops->name, diff, t, (unsigned long long)traceSeed, capacity);
+                }
+                ok = false;
+            }
+        }
+        printf("%-10s %d/%d trazas coinciden con remove y evict\n", oracle->ops->name, numTraces - failures, numTraces);
+    }
+
+    free(trace);
+    free(nextUse);
+    return ok;
+}
+
+#endif
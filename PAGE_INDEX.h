@@ -0,0 +1,174 @@
+#ifndef PAGE_INDEX_H
+#define PAGE_INDEX_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#define EMPTY_PAGE (-1)   // Número de página reservado para las ranuras vacías del índice
+
+// EMPTY_PAGE es el mismo valor que NO_PAGE y no puede guardarse: indexInsert la rechaza (devuelve
+// false) e indexFind e indexRemove nunca la encuentran, así una ranura vacía no pasa por ocupada
+
+// Entrada del índice: número de página y valor asociado (frame, ranura, posición, etc.)
+typedef struct IndexEntry {
+    int64_t page;       // Número de página almacenada (EMPTY_PAGE si la ranura está libre)
+    uint64_t value;     // Valor asociado a la página
+} IndexEntry;
+
+// Índice página -> valor con direccionamiento abierto y sondeo lineal
+typedef struct PageIndex {
+    IndexEntry *entries; // Arreglo de ranuras (tamaño potencia de dos)
+    uint64_t mask;       // Tamaño del arreglo menos uno (para calcular la ranura con un AND)
+    uint64_t count;      // Número de páginas almacenadas en el índice
+} PageIndex;
+
+// Función para dispersar un número de página (finalizador de MurmurHash3): todos los bits de la
+// página llegan a los bits bajos, de donde sale la ranura, incluidos los del proceso (bits 48..62)
+static inline uint64_t hashPage(int64_t page) {
+    uint64_t h = (uint64_t)page;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+// Función para reservar un arreglo de ranuras vacías
+static inline IndexEntry* allocIndexEntries(uint64_t size) {
+    IndexEntry *entries = (IndexEntry *)malloc(size * sizeof(IndexEntry));
+    if (entries != NULL) {
+        for (uint64_t i = 0; i < size; ++i) {
+            entries[i].page = EMPTY_PAGE;
+            entries[i].value = 0;
+        }
+    }
+    return entries;
+}
+
+// Función para crear un índice con espacio para 'capacity' páginas sin redimensionar
+static inline PageIndex* createPageIndex(uint64_t capacity) {
+    PageIndex *index = (PageIndex *)malloc(sizeof(PageIndex));
+    if (index == NULL) {
+        return NULL;
+    }
+
+    // Factor de carga máximo de 1/2 para que las cadenas de sondeo sean cortas
+    uint64_t size = 16;
+    while (size < capacity * 2) {
+        size <<= 1;
+    }
+
+    index->entries = allocIndexEntries(size);
+    if (index->entries == NULL) {
+        free(index);
+        return NULL;
+    }
+    index->mask = size - 1;
+    index->count = 0;
+    return index;
+}
+
+// Función para liberar la memoria utilizada por el índice
+static inline void destroyPageIndex(PageIndex *index) {
+    if (index != NULL) {
+        free(index->entries);
+        free(index);
+    }
+}
+
+// Función para buscar una página; devuelve un puntero a su valor o NULL si no está
+static inline uint64_t* indexFind(PageIndex *index, int64_t page) {
+    if (page == EMPTY_PAGE) {
+        return NULL;
+    }
+    uint64_t slot = hashPage(page) & index->mask;
+    while (index->entries[slot].page != EMPTY_PAGE) {
+        if (index->entries[slot].page == page) {
+            return &index->entries[slot].value;
+        }
+        slot = (slot + 1) & index->mask;
+    }
+    return NULL;
+}
+
+// Función para duplicar el tamaño del índice cuando supera el factor de carga
+static inline bool growPageIndex(PageIndex *index) {
+    uint64_t oldSize = index->mask + 1;
+    IndexEntry *old = index->entries;
+    IndexEntry *entries = allocIndexEntries(oldSize * 2);
+    if (entries == NULL) {
+        return false;
+    }
+
+    index->entries = entries;
+    index->mask = oldSize * 2 - 1;
+    for (uint64_t i = 0; i < oldSize; ++i) {
+        if (old[i].page != EMPTY_PAGE) {
+            uint64_t slot = hashPage(old[i].page) & index->mask;
+            while (entries[slot].page != EMPTY_PAGE) {
+                slot = (slot + 1) & index->mask;
+            }
+            entries[slot] = old[i];
+        }
+    }
+    free(old);
+    return true;
+}
+
+// Función para insertar una página (o actualizar su valor si ya existe); devuelve false si falta
+// memoria o la página es EMPTY_PAGE
+static inline bool indexInsert(PageIndex *index, int64_t page, uint64_t value) {
+    if (page == EMPTY_PAGE) {
+        return false;
+    }
+    if ((index->count + 1) * 2 > index->mask + 1 && !growPageIndex(index)) {
+        return false;
+    }
+
+    uint64_t slot = hashPage(page) & index->mask;
+    while (index->entries[slot].page != EMPTY_PAGE) {
+        if (index->entries[slot].page == page) {
+            index->entries[slot].value = value;
+            return true;
+        }
+        slot = (slot + 1) & index->mask;
+    }
+    index->entries[slot].page = page;
+    index->entries[slot].value = value;
+    index->count++;
+    return true;
+}
+
+// Función para eliminar una página del índice (borrado con desplazamiento hacia atrás, sin lápidas)
+static inline bool indexRemove(PageIndex *index, int64_t page) {
+    if (page == EMPTY_PAGE) {
+        return false;
+    }
+    uint64_t slot = hashPage(page) & index->mask;
+    while (index->entries[slot].page != page) {
+        if (index->entries[slot].page == EMPTY_PAGE) {
+            return false; // La página no estaba indexada
+        }
+        slot = (slot + 1) & index->mask;
+    }
+
+    // Recorrer el resto de la cadena y mover hacia el hueco las entradas que lo necesiten
+    uint64_t hole = slot;
+    uint64_t next = (slot + 1) & index->mask;
+    while (index->entries[next].page != EMPTY_PAGE) {
+        uint64_t home = hashPage(index->entries[next].page) & index->mask;
+        // La entrada puede ocupar el hueco si su ranura ideal no está entre el hueco y su posición actual
+        if (((next - home) & index->mask) >= ((next - hole) & index->mask)) {
+            index->entries[hole] = index->entries[next];
+            hole = next;
+        }
+        next = (next + 1) & index->mask;
+    }
+    index->entries[hole].page = EMPTY_PAGE;
+    index->count--;
+    return true;
+}
+
+#endif
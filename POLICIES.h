@@ -0,0 +1,44 @@
+#ifndef POLICIES_H
+#define POLICIES_H
+
+#include <string.h>
+#include "POLICY.h"
+#include "POLICY_FIFO.h"
+#include "POLICY_LRU.h"
+#include "POLICY_CLOCK.h"
+#include "POLICY_LFU.h"
+#include "POLICY_OPT.h"
+#include "POLICY_ARC.h"
+#include "POLICY_2Q.h"
+#include "POLICY_LIRS.h"
+#include "POLICY_CLOCKPRO.h"
+#include "POLICY_SAMPLED.h"
+
+// Todas las políticas disponibles en la biblioteca
+static const PolicyOps *const allPolicies[] = {
+    &fifoPolicy,
+    &lruPolicy,
+    &clockPolicy,
+    &gclockPolicy,
+    &lfuPolicy,
+    &optPolicy,
+    &arcPolicy,
+    &twoQPolicy,
+    &lirsPolicy,
+    &clockProPolicy,
+    &sampledLruPolicy,
+};
+
+#define NUM_POLICIES ((int)(sizeof(allPolicies) / sizeof(allPolicies[0])))
+
+// Función para buscar una política por su nombre corto (NULL si no existe)
+static inline const PolicyOps* findPolicy(const char *name) {
+    for (int i = 0; i < NUM_POLICIES; ++i) {
+        if (strcmp(allPolicies[i]->name, name) == 0) {
+            return allPolicies[i];
+        }
+    }
+    return NULL;
+}
+
+#endif
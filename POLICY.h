@@ -0,0 +1,213 @@
+#ifndef POLICY_H
+#define POLICY_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "FRAME_LIST.h"
+#include "PAGE_INDEX.h"
+
+#define NEVER UINT64_MAX   // Próximo uso de una página que ya no vuelve a ser referenciada
+
+// Operaciones que implementa cada política de reemplazo
+typedef struct PolicyOps {
+    const char *name;          // Nombre corto de la política ("fifo", "lru", ...)
+    const char *description;   // Descripción para mostrar en los resultados
+    bool needsFuture;          // Indica si la política necesita el próximo uso de cada acceso (OPT)
+
+    // Crear el estado de la política para 'capacity' frames
+    void* (*init)(int capacity);
+    // Acceder a una página (nunca negativa); devuelve true si hubo acierto. En un fallo carga la
+    // página y, si tuvo que expulsar otra, la devuelve en 'victim' (NO_PAGE si no hubo expulsión)
+    bool (*access)(void *state, PageId page, uint64_t nextUse, PageId *victim);
+    // Expulsar una página elegida por la política (NO_PAGE si no hay páginas cargadas)
+    PageId (*evict)(void *state);
+    // Quitar una página cargada sin que la política la elija (por ejemplo, porque pasa a otro
+    // nivel de una jerarquía); devuelve false si no estaba cargada. NULL si la política no lo admite
+    bool (*remove)(void *state, PageId page);
+    // Imprimir el estado de los frames (solo para fines de depuración)
+    void (*print)(void *state);
+    // Liberar el estado de la política
+    void (*destroy)(void *state);
+} PolicyOps;
+
+// Contadores de una simulación
+typedef struct PolicyStats {
+    uint64_t accesses;      // Número total de accesos
+    uint64_t hits;          // Accesos a páginas que ya estaban en memoria
+    uint64_t misses;        // Fallos de página
+    uint64_t evictions;     // Páginas expulsadas de memoria
+    uint64_t compulsory;    // Fallos en el primer acceso a una página (solo con policyTrackFaults)
+    uint64_t capacity;      // Fallos de páginas que ya habían estado en memoria (solo con policyTrackFaults)
+} PolicyStats;
+
+// Instancia de una política con su estado y sus contadores
+typedef struct Policy {
+    const PolicyOps *ops;   // Operaciones de la política
+    void *state;            // Estado interno de la política
+    int capacity;           // Número de frames disponibles
+    PolicyStats stats;      // Contadores acumulados
+    PageIndex *faults;      // Fallos por página (NULL si no se registran)
+} Policy;
+
+// Función para crear una instancia de una política con 'capacity' frames (de 1 a MAX_FRAMES);
+// devuelve NULL si el número de frames no es válido o no hay memoria
+static inline Policy* createPolicy(const PolicyOps *ops, int capacity) {
+    if (capacity < 1 || capacity > MAX_FRAMES) {
+        return NULL;
+    }
+    Policy *policy = (Policy *)calloc(1, sizeof(Policy));
+    if (policy == NULL) {
+        return NULL;
+    }
+    policy->ops = ops;
+    policy->capacity = capacity;
+    policy->state = ops->init(capacity);
+    if (policy->state == NULL) {
+        free(policy);
+        return NULL;
+    }
+    return policy;
+}
+
+// Función para registrar también los fallos de cada página y separar los fallos obligatorios
+// de los de capacidad (cuesta una búsqueda en un índice por cada fallo)
+static inline bool policyTrackFaults(Policy *policy) {
+    if (policy->faults == NULL) {
+        policy->faults = createPageIndex(policy->capacity);
+    }
+    return policy->faults != NULL;
+}
+
+// Función para contar un fallo de página en los contadores por página
+static inline void policyCountFault(Policy *policy, PageId page) {
+    uint64_t *faults = indexFind(policy->faults, page);
+    if (faults != NULL) {
+        (*faults)++;
+        policy->stats.capacity++;
+    } else {
+        indexInsert(policy->faults, page, 1);
+        policy->stats.compulsory++;
+    }
+}
+
+// Función para simular un acceso a una página y actualizar los contadores. Una página negativa
+// está reservada (NO_PAGE marca las ranuras vacías de las políticas) y se rechaza: no se simula,
+// no se cuenta y devuelve false
+static inline bool policyAccess(Policy *policy, PageId page, uint64_t nextUse, PageId *victim) {
+    PageId evicted = NO_PAGE;
+    if (page < 0) {
+        if (victim != NULL) {
+            *victim = NO_PAGE;
+        }
+        return false;
+    }
+    bool hit = policy->ops->access(policy->state, page, nextUse, &evicted);
+    policy->stats.accesses++;
+    if (hit) {
+        policy->stats.hits++;
+    } else {
+        policy->stats.misses++;
+        if (evicted != NO_PAGE) {
+            policy->stats.evictions++;
+        }
+        if (policy->faults != NULL) {
+            policyCountFault(policy, page);
+        }
+    }
+    if (victim != NULL) {
+        *victim = evicted;
+    }
+    return hit;
+}
+
+// Función para forzar la expulsión de una página
+static inline PageId policyEvict(Policy *policy) {
+    PageId victim = policy->ops->evict(policy->state);
+    if (victim != NO_PAGE) {
+        policy->stats.evictions++;
+    }
+    return victim;
+}
+
+// Función para quitar una página cargada sin contarla como expulsión (la política debe admitir
+// remove); devuelve false si la página no estaba cargada
+static inline bool policyRemove(Policy *policy, PageId page) {
+    return policy->ops->remove(policy->state, page);
+}
+
+// Función para liberar una instancia de una política
+static inline void destroyPolicy(Policy *policy) {
+    if (policy != NULL) {
+        policy->ops->destroy(policy->state);
+        destroyPageIndex(policy->faults);
+        free(policy);
+    }
+}
+
+// Función para imprimir el encabezado de la tabla de resultados
+static inline void printStatsHeader() {
+    printf("%-11s %8s %14s %14s %14s %10s\n", "Política", "Frames", "Accesos", "Aciertos", "Fallos", "Aciertos%");
+}
+
+// Función para imprimir los contadores de una política como una fila de la tabla
+static inline void printPolicyStats(Policy *policy) {
+    const PolicyStats *s = &policy->stats;
+    printf("%-10s %8d %14llu %14llu %14llu %9.2f%%\n", policy->ops->name, policy->capacity,
+           (unsigned long long)s->accesses, (unsigned long long)s->hits, (unsigned long long)s->misses,
+           s->accesses > 0 ? 100.0 * s->hits / s->accesses : 0.0);
+}
+
+// Función para imprimir el encabezado de la tabla de contadores detallados
+static inline void printCountersHeader() {
+    printf("%-11s %8s %14s %14s %14s %14s %15s\n", "Política", "Frames", "Fallos", "Obligatorios", "Capacidad",
+           "Expulsiones", "Páginas");
+}
+
+// Función para imprimir los contadores detallados de una política (requiere policyTrackFaults)
+static inline void printPolicyCounters(Policy *policy) {
+    const PolicyStats *s = &policy->stats;
+    printf("%-10s %8d %14llu %14llu %14llu %14llu %14llu\n", policy->ops->name, policy->capacity,
+           (unsigned long long)s->misses, (unsigned long long)s->compulsory, (unsigned long long)s->capacity,
+           (unsigned long long)s->evictions, (unsigned long long)(policy->faults != NULL ? policy->faults->count : 0));
+}
+
+// Función para ordenar las páginas de mayor a menor número de fallos
+static int compareFaultCounts(const void *a, const void *b) {
+    uint64_t fa = ((const IndexEntry *)a)->value;
+    uint64_t fb = ((const IndexEntry *)b)->value;
+    if (fa != fb) {
+        return (fa < fb) - (fa > fb);
+    }
+    int64_t pa = ((const IndexEntry *)a)->page;
+    int64_t pb = ((const IndexEntry *)b)->page;
+    return (pa > pb) - (pa < pb);
+}
+
+// Función para imprimir las 'top' páginas con más fallos de una política (requiere policyTrackFaults)
+static inline void printPageFaults(Policy *policy, int top) {
+    PageIndex *faults = policy->faults;
+    if (faults == NULL || faults->count == 0) {
+        return;
+    }
+    IndexEntry *pages = (IndexEntry *)malloc(faults->count * sizeof(IndexEntry));
+    if (pages == NULL) {
+        return;
+    }
+    uint64_t n = 0;
+    for (uint64_t i = 0; i <= faults->mask; ++i) {
+        if (faults->entries[i].page != EMPTY_PAGE) {
+            pages[n++] = faults->entries[i];
+        }
+    }
+    qsort(pages, n, sizeof(IndexEntry), compareFaultCounts);
+
+    printf("Páginas con más fallos (%s, %d frames):\n", policy->ops->name, policy->capacity);
+    for (uint64_t i = 0; i < n && i < (uint64_t)top; ++i) {
+        printf("  Página: %lld, Fallos: %llu\n", (long long)pages[i].page, (unsigned long long)pages[i].value);
+    }
+    free(pages);
+}
+
+#endif
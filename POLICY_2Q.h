@@ -0,0 +1,171 @@
+#ifndef POLICY_2Q_H
+#define POLICY_2Q_H
+
+#include "POLICY.h"
+#include "PAGE_INDEX.h"
+
+// 2Q (Johnson y Shasha, versión completa): una página nueva entra a A1in, una cola FIFO pequeña
+// (Kin = capacity / 4), y al salir de ella deja su número en A1out, una cola FIFO fantasma
+// (Kout = capacity / 2). Solo una página que vuelve a pedirse mientras está en A1out se considera
+// caliente y pasa a Am, que se administra como LRU. Un recorrido secuencial entra y sale por A1in
+// sin tocar Am, y una página que se usa dos veces seguidas no se promueve por eso (los aciertos en
+// A1in no cambian nada).
+// Las tres colas comparten un arreglo de capacity + Kout frames y un solo índice;
+// head = más reciente, tail = más antiguo (el siguiente en salir).
+
+enum TwoQList { TWOQ_A1IN, TWOQ_AM, TWOQ_A1OUT, TWOQ_LISTS };
+
+#define TWOQ_LIST_SHIFT 32   // El valor del índice guarda el frame en los bits bajos y la cola en los altos
+
+// Estado de la política 2Q
+typedef struct TwoQState {
+    FrameList *pool;                // Arreglo de frames compartido por las tres colas
+    FrameList lists[TWOQ_LISTS];    // A1in, Am y A1out (vistas sobre 'pool')
+    PageIndex *index;               // Índice página -> (cola, frame), residentes y fantasmas
+    int inLimit;                    // Kin: tamaño a partir del cual se expulsa de A1in
+    int outLimit;                   // Kout: número máximo de fantasmas en A1out
+    int capacity;                   // Número máximo de frames residentes
+} TwoQState;
+
+// Función para crear el estado de la política 2Q
+static inline void* twoQInit(int capacity) {
+    TwoQState *twoQ = (TwoQState *)malloc(sizeof(TwoQState));
+    if (twoQ == NULL) {
+        return NULL;
+    }
+    twoQ->inLimit = capacity / 4 > 0 ? capacity / 4 : 1;
+    twoQ->outLimit = capacity / 2 > 0 ? capacity / 2 : 1;
+    twoQ->capacity = capacity;
+    twoQ->pool = createFrameList(capacity + twoQ->outLimit);
+    twoQ->index = createPageIndex((uint64_t)capacity + twoQ->outLimit);
+    if (twoQ->pool == NULL || twoQ->index == NULL) {
+        destroyFrameList(twoQ->pool);
+        destroyPageIndex(twoQ->index);
+        free(twoQ);
+        return NULL;
+    }
+    for (int i = 0; i < TWOQ_LISTS; ++i) {
+        initFrameListView(&twoQ->lists[i], twoQ->pool);
+    }
+    return twoQ;
+}
+
+// Función para olvidar un frame de una cola
+static inline PageId twoQDrop(TwoQState *twoQ, int list, uint32_t frame) {
+    PageId page = frameAt(twoQ->pool, frame)->page;
+    unlinkFrame(&twoQ->lists[list], frame);
+    freeFrame(twoQ->pool, frame);
+    indexRemove(twoQ->index, page);
+    return page;
+}
+
+// Función para olvidar el frame más antiguo de una cola
+static inline PageId twoQDropOldest(TwoQState *twoQ, int list) {
+    return twoQDrop(twoQ, list, twoQ->lists[list].tail);
+}
+
+// Función para liberar un frame residente: si A1in supera Kin (o Am está vacía) su página más
+// antigua pasa a A1out; si no, se expulsa la página LRU de Am sin dejar fantasma
+static inline PageId twoQReclaim(TwoQState *twoQ) {
+    if (twoQ->lists[TWOQ_A1IN].numFrames > twoQ->inLimit || twoQ->lists[TWOQ_AM].numFrames == 0) {
+        uint32_t frame = twoQ->lists[TWOQ_A1IN].tail;
+        Frame *f = frameAt(twoQ->pool, frame);
+        unlinkFrame(&twoQ->lists[TWOQ_A1IN], frame);
+        if (twoQ->lists[TWOQ_A1OUT].numFrames == twoQ->outLimit) {
+            twoQDropOldest(twoQ, TWOQ_A1OUT);
+        }
+        insertFrame(&twoQ->lists[TWOQ_A1OUT], frame);
+        f->valid = false;
+        *indexFind(twoQ->index, f->page) = (uint64_t)frame | ((uint64_t)TWOQ_A1OUT << TWOQ_LIST_SHIFT);
+        return f->page;
+    }
+    return twoQDropOldest(twoQ, TWOQ_AM);
+}
+
+// Función para expulsar una página elegida por 2Q
+static inline PageId twoQEvict(void *state) {
+    TwoQState *twoQ = (TwoQState *)state;
+    if (twoQ->lists[TWOQ_A1IN].numFrames + twoQ->lists[TWOQ_AM].numFrames == 0) {
+        return NO_PAGE;
+    }
+    return twoQReclaim(twoQ);
+}
+
+// Función para quitar una página residente (de A1in o de Am) sin dejarla en A1out
+static inline bool twoQRemove(void *state, PageId page) {
+    TwoQState *twoQ = (TwoQState *)state;
+    uint64_t *value = indexFind(twoQ->index, page);
+    if (value == NULL) {
+        return false;
+    }
+    int list = (int)(*value >> TWOQ_LIST_SHIFT);
+    if (list == TWOQ_A1OUT) {
+        return false;
+    }
+    twoQDrop(twoQ, list, (uint32_t)*value);
+    return true;
+}
+
+// Función para simular la carga de una página a memoria física utilizando 2Q
+static inline bool twoQAccess(void *state, PageId page, uint64_t nextUse, PageId *victim) {
+    TwoQState *twoQ = (TwoQState *)state;
+    (void)nextUse;
+    uint64_t *value = indexFind(twoQ->index, page);
+    int list = TWOQ_LISTS;
+    if (value != NULL) {
+        uint32_t frame = (uint32_t)*value;
+        list = (int)(*value >> TWOQ_LIST_SHIFT);
+        if (list == TWOQ_AM) {
+            moveToFront(&twoQ->lists[TWOQ_AM], frame);
+            return true;
+        }
+        if (list == TWOQ_A1IN) {
+            return true; // Correlacionado con la carga: no se promueve
+        }
+        // Acierto fantasma: se olvida antes de liberar espacio para que A1out no lo descarte
+        unlinkFrame(&twoQ->lists[TWOQ_A1OUT], frame);
+        freeFrame(twoQ->pool, frame);
+        indexRemove(twoQ->index, page);
+    }
+
+    if (twoQ->lists[TWOQ_A1IN].numFrames + twoQ->lists[TWOQ_AM].numFrames == twoQ->capacity) {
+        *victim = twoQReclaim(twoQ);
+    }
+    int to = list == TWOQ_A1OUT ? TWOQ_AM : TWOQ_A1IN;
+    uint32_t frame = createFrame(twoQ->pool);
+    frameAt(twoQ->pool, frame)->page = page;
+    frameAt(twoQ->pool, frame)->valid = true;
+    insertFrame(&twoQ->lists[to], frame);
+    indexInsert(twoQ->index, page, (uint64_t)frame | ((uint64_t)to << TWOQ_LIST_SHIFT));
+    return false;
+}
+
+// Función para imprimir las colas de 2Q (solo para fines de depuración)
+static inline void twoQPrint(void *state) {
+    TwoQState *twoQ = (TwoQState *)state;
+    static const char *const names[TWOQ_LISTS] = {"A1in", "Am", "A1out"};
+    printf("Estado actual de 2Q (Kin = %d, Kout = %d):\n", twoQ->inLimit, twoQ->outLimit);
+    for (int list = 0; list < TWOQ_LISTS; ++list) {
+        printf("%s:", names[list]);
+        for (uint32_t current = twoQ->lists[list].head; current != NIL_FRAME; current = frameAt(twoQ->pool, current)->next) {
+            printf(" %lld", (long long)frameAt(twoQ->pool, current)->page);
+        }
+        printf("\n");
+    }
+    printf("\n");
+}
+
+// Función para liberar el estado de la política 2Q
+static inline void twoQDestroy(void *state) {
+    TwoQState *twoQ = (TwoQState *)state;
+    destroyFrameList(twoQ->pool);
+    destroyPageIndex(twoQ->index);
+    free(twoQ);
+}
+
+static const PolicyOps twoQPolicy = {
+    "2q", "2Q (A1in/A1out/Am)", false,
+    twoQInit, twoQAccess, twoQEvict, twoQRemove, twoQPrint, twoQDestroy
+};
+
+#endif
@@ -0,0 +1,208 @@
+#ifndef POLICY_ARC_H
+#define POLICY_ARC_H
+
+#include "POLICY.h"
+#include "PAGE_INDEX.h"
+
+// ARC (Adaptive Replacement Cache, Megiddo y Modha): las páginas residentes se reparten entre
+// T1 (vistas una sola vez recientemente) y T2 (vistas al menos dos veces), y las listas fantasma
+// B1 y B2 recuerdan solo el número de página de las últimas expulsadas de T1 y T2. Un acierto en
+// B1 indica que T1 debió ser más grande y uno en B2 lo contrario, así que el tamaño objetivo 'p'
+// de T1 se ajusta solo entre el extremo LRU (recencia) y el LFU (frecuencia). Un recorrido
+// secuencial solo pasa por T1 y no desplaza a las páginas frecuentes de T2.
+// Las cuatro listas comparten un arreglo de 2 * capacity frames (capacity residentes y como
+// máximo capacity fantasmas); head = más recientemente usado, tail = menos recientemente usado.
+
+enum ArcList { ARC_T1, ARC_T2, ARC_B1, ARC_B2, ARC_LISTS };
+
+#define ARC_LIST_SHIFT 32   // El valor del índice guarda el frame en los bits bajos y la lista en los altos
+
+// Estado de la política ARC
+typedef struct ArcState {
+    FrameList *pool;                // Arreglo de frames compartido por las cuatro listas
+    FrameList lists[ARC_LISTS];     // T1, T2, B1 y B2 (vistas sobre 'pool')
+    PageIndex *index;               // Índice página -> (lista, frame), residentes y fantasmas
+    int target;                     // Tamaño objetivo 'p' de T1
+    int capacity;                   // Número máximo de frames residentes
+} ArcState;
+
+// Función para crear el estado de la política ARC
+static inline void* arcInit(int capacity) {
+    ArcState *arc = (ArcState *)malloc(sizeof(ArcState));
+    if (arc == NULL) {
+        return NULL;
+    }
+    arc->pool = createFrameList(2 * capacity);
+    arc->index = createPageIndex(2 * (uint64_t)capacity);
+    arc->target = 0;
+    arc->capacity = capacity;
+    if (arc->pool == NULL || arc->index == NULL) {
+        destroyFrameList(arc->pool);
+        destroyPageIndex(arc->index);
+        free(arc);
+        return NULL;
+    }
+    for (int i = 0; i < ARC_LISTS; ++i) {
+        initFrameListView(&arc->lists[i], arc->pool);
+    }
+    return arc;
+}
+
+// Función para obtener el número de frames de una lista
+static inline int arcSize(ArcState *arc, int list) {
+    return arc->lists[list].numFrames;
+}
+
+// Función para mover un frame al frente (MRU) de otra lista
+static inline void arcMove(ArcState *arc, uint32_t frame, int from, int to) {
+    unlinkFrame(&arc->lists[from], frame);
+    insertFrame(&arc->lists[to], frame);
+    Frame *f = frameAt(arc->pool, frame);
+    f->valid = to == ARC_T1 || to == ARC_T2;
+    *indexFind(arc->index, f->page) = (uint64_t)frame | ((uint64_t)to << ARC_LIST_SHIFT);
+}
+
+// Función para olvidar un frame de una lista
+static inline PageId arcDrop(ArcState *arc, int list, uint32_t frame) {
+    PageId page = frameAt(arc->pool, frame)->page;
+    unlinkFrame(&arc->lists[list], frame);
+    freeFrame(arc->pool, frame);
+    indexRemove(arc->index, page);
+    return page;
+}
+
+// Función para olvidar la página menos recientemente usada de una lista
+static inline PageId arcDropLru(ArcState *arc, int list) {
+    return arcDrop(arc, list, arc->lists[list].tail);
+}
+
+// Función REPLACE de ARC: expulsa de memoria el LRU de T1 o de T2 según el objetivo 'p' y lo
+// pasa a su lista fantasma; 'inB2' indica si la página que provocó el fallo estaba en B2
+static inline PageId arcReplace(ArcState *arc, bool inB2) {
+    int t1 = arcSize(arc, ARC_T1);
+    if (t1 > 0 && (t1 > arc->target || (inB2 && t1 == arc->target) || arcSize(arc, ARC_T2) == 0)) {
+        uint32_t frame = arc->lists[ARC_T1].tail;
+        arcMove(arc, frame, ARC_T1, ARC_B1);
+        return frameAt(arc->pool, frame)->page;
+    }
+    uint32_t frame = arc->lists[ARC_T2].tail;
+    arcMove(arc, frame, ARC_T2, ARC_B2);
+    return frameAt(arc->pool, frame)->page;
+}
+
+// Función para expulsar una página elegida por ARC
+static inline PageId arcEvict(void *state) {
+    ArcState *arc = (ArcState *)state;
+    if (arcSize(arc, ARC_T1) + arcSize(arc, ARC_T2) == 0) {
+        return NO_PAGE;
+    }
+    return arcReplace(arc, false);
+}
+
+// Función para quitar una página residente; no deja fantasma porque ARC no la eligió
+static inline bool arcRemove(void *state, PageId page) {
+    ArcState *arc = (ArcState *)state;
+    uint64_t *value = indexFind(arc->index, page);
+    if (value == NULL) {
+        return false;
+    }
+    int list = (int)(*value >> ARC_LIST_SHIFT);
+    if (list != ARC_T1 && list != ARC_T2) {
+        return false;
+    }
+    arcDrop(arc, list, (uint32_t)*value);
+    return true;
+}
+
+// Función para simular la carga de una página a memoria física utilizando ARC
+static inline bool arcAccess(void *state, PageId page, uint64_t nextUse, PageId *victim) {
+    ArcState *arc = (ArcState *)state;
+    (void)nextUse;
+    int c = arc->capacity;
+    bool full = arcSize(arc, ARC_T1) + arcSize(arc, ARC_T2) == c;
+    uint64_t *value = indexFind(arc->index, page);
+
+    if (value != NULL) {
+        uint32_t frame = (uint32_t)*value;
+        int list = (int)(*value >> ARC_LIST_SHIFT);
+        if (list == ARC_T1 || list == ARC_T2) {
+            // Acierto: la página pasa (o vuelve) al frente de T2
+            arcMove(arc, frame, list, ARC_T2);
+            return true;
+        }
+
+        // Acierto fantasma: ajustar 'p' a favor de la lista que lo habría evitado
+        int b1 = arcSize(arc, ARC_B1);
+        int b2 = arcSize(arc, ARC_B2);
+        if (list == ARC_B1) {
+            int delta = b1 >= b2 ? 1 : b2 / b1;
+            arc->target = arc->target + delta < c ? arc->target + delta : c;
+        } else {
+            int delta = b2 >= b1 ? 1 : b1 / b2;
+            arc->target = arc->target - delta > 0 ? arc->target - delta : 0;
+        }
+        if (full) {
+            *victim = arcReplace(arc, list == ARC_B2);
+        }
+        arcMove(arc, frame, list, ARC_T2);
+        return false;
+    }
+
+    // Página nueva: mantener |T1| + |B1| <= c y el total de las cuatro listas <= 2c
+    int l1 = arcSize(arc, ARC_T1) + arcSize(arc, ARC_B1);
+    int total = l1 + arcSize(arc, ARC_T2) + arcSize(arc, ARC_B2);
+    if (l1 == c) {
+        if (arcSize(arc, ARC_T1) < c) {
+            arcDropLru(arc, ARC_B1);
+            if (full) {
+                *victim = arcReplace(arc, false);
+            }
+        } else {
+            *victim = arcDropLru(arc, ARC_T1); // B1 está vacía: la página sale sin dejar fantasma
+        }
+    } else if (total >= c) {
+        if (total == 2 * c) {
+            arcDropLru(arc, ARC_B2);
+        }
+        if (full) {
+            *victim = arcReplace(arc, false);
+        }
+    }
+
+    uint32_t frame = createFrame(arc->pool);
+    frameAt(arc->pool, frame)->page = page;
+    frameAt(arc->pool, frame)->valid = true;
+    insertFrame(&arc->lists[ARC_T1], frame);
+    indexInsert(arc->index, page, (uint64_t)frame | ((uint64_t)ARC_T1 << ARC_LIST_SHIFT));
+    return false;
+}
+
+// Función para imprimir las listas de ARC (solo para fines de depuración)
+static inline void arcPrint(void *state) {
+    ArcState *arc = (ArcState *)state;
+    static const char *const names[ARC_LISTS] = {"T1", "T2", "B1", "B2"};
+    printf("Estado actual de ARC (p = %d):\n", arc->target);
+    for (int list = 0; list < ARC_LISTS; ++list) {
+        printf("%s:", names[list]);
+        for (uint32_t current = arc->lists[list].head; current != NIL_FRAME; current = frameAt(arc->pool, current)->next) {
+            printf(" %lld", (long long)frameAt(arc->pool, current)->page);
+        }
+        printf("\n");
+    }
+    printf("\n");
+}
+
+// Función para liberar el estado de la política ARC
+static inline void arcDestroy(void *state) {
+    ArcState *arc = (ArcState *)state;
+    destroyFrameList(arc->pool);
+    destroyPageIndex(arc->index);
+    free(arc);
+}
+
+static const PolicyOps arcPolicy = {
+    "arc", "ARC (reemplazo adaptativo)", false,
+    arcInit, arcAccess, arcEvict, arcRemove, arcPrint, arcDestroy
+};
+
+#endif
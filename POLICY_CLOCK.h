@@ -0,0 +1,316 @@
+#ifndef POLICY_CLOCK_H
+#define POLICY_CLOCK_H
+
+#include "POLICY.h"
+#include "PAGE_INDEX.h"
+#include "SMALL_SET.h"
+
+#define CLOCK_INDEX_SLACK 2   // El índice se dimensiona para 2 * capacity páginas (carga <= 1/4, sondeos cortos)
+#define GCLOCK_MAX_COUNT 3    // Valor máximo del contador de referencias de GCLOCK
+
+// Estado de la política Clock: anillo plano de ranuras con una manecilla
+// Los bits de referencia se guardan empaquetados (64 ranuras por palabra) para que la manecilla
+// pueda saltar de una vez todas las ranuras con el bit encendido de una palabra.
+// GCLOCK usa el mismo anillo con un contador saturado de 8 bits por ranura en lugar del bit
+// (8 ranuras por palabra): un acierto suma 1 hasta GCLOCK_MAX_COUNT y la manecilla resta 1 a
+// cada ranura que pasa, así que una página muy usada sobrevive varias vueltas.
+// Con pocos frames el arreglo de ranuras es a la vez un conjunto pequeño (SMALL_SET.h) y los
+// aciertos se detectan recorriéndolo, sin índice
+typedef struct ClockState {
+    int numFrames;          // Número de frames actualmente ocupados
+    int capacity;           // Número máximo de frames (ranuras del anillo)
+    uint32_t hand;          // Ranura señalada por la manecilla del reloj
+    PageId *pages;          // Página cargada en cada ranura (NO_PAGE si está vacía)
+    uint64_t *referenced;   // Bits de referencia, uno por ranura (Clock)
+    uint64_t *counts;       // Contadores de referencias, 8 ranuras por palabra (GCLOCK; NULL en Clock)
+    uint32_t *freeSlots;    // Pila de ranuras vacías
+    int numFree;            // Número de ranuras en la pila de vacías
+    PageIndex *index;       // Índice página -> ranura para detectar aciertos en O(1) (NULL con pocos frames)
+    SmallSetFind find;      // Búsqueda en el arreglo de ranuras (NULL si se usa el índice)
+    int slots;              // Ranuras que recorre la búsqueda (capacity más el relleno)
+} ClockState;
+
+// Función para crear el estado de Clock (o de GCLOCK si 'counted' es true)
+static inline ClockState* createClockState(int capacity, bool counted) {
+    ClockState *clockState = (ClockState *)calloc(1, sizeof(ClockState));
+    if (clockState == NULL) {
+        return NULL;
+    }
+    size_t words = counted ? ((size_t)capacity + 7) / 8 : ((size_t)capacity + 63) / 64;
+    uint64_t **bits = counted ? &clockState->counts : &clockState->referenced;
+    clockState->capacity = capacity;
+    clockState->pages = createSmallSet(capacity);
+    *bits = (uint64_t *)calloc(words > 0 ? words : 1, sizeof(uint64_t));
+    clockState->freeSlots = (uint32_t *)malloc((size_t)capacity * sizeof(uint32_t));
+    if (capacity <= SMALL_SET_MAX_FRAMES) {
+        clockState->find = smallSetBestFind();
+        clockState->slots = smallSetSlots(capacity);
+    } else {
+        clockState->index = createPageIndex((uint64_t)capacity * CLOCK_INDEX_SLACK);
+    }
+    if (clockState->pages == NULL || *bits == NULL || clockState->freeSlots == NULL ||
+        (clockState->find == NULL && clockState->index == NULL)) {
+        free(clockState->pages);
+        free(*bits);
+        free(clockState->freeSlots);
+        destroyPageIndex(clockState->index);
+        free(clockState);
+        return NULL;
+    }
+
+    // Las ranuras se ocupan en orden (0, 1, 2, ...), así la manecilla empieza en la más antigua
+    for (int i = 0; i < capacity; ++i) {
+        clockState->freeSlots[i] = (uint32_t)(capacity - 1 - i);
+    }
+    clockState->numFree = capacity;
+    return clockState;
+}
+
+// Función para crear el estado de la política Clock
+static inline void* clockInit(int capacity) {
+    return createClockState(capacity, false);
+}
+
+// Función para crear el estado de la política GCLOCK
+static inline void* gclockInit(int capacity) {
+    return createClockState(capacity, true);
+}
+
+// Función para buscar la ranura de una página (-1 si no está en memoria)
+static inline int clockFind(ClockState *clockState, PageId page) {
+    if (clockState->find != NULL) {
+        return clockState->find(clockState->pages, clockState->slots, page);
+    }
+    uint64_t *value = indexFind(clockState->index, page);
+    return value != NULL ? (int)*value : -1;
+}
+
+// Función para encender el bit de referencia de una ranura
+static inline void clockReference(ClockState *clockState, uint32_t slot) {
+    clockState->referenced[slot >> 6] |= 1ULL << (slot & 63);
+}
+
+// Función para avanzar la manecilla hasta una ranura sin bit de referencia, apagando (dando
+// segunda oportunidad a) todos los bits encendidos que encuentre; procesa 64 ranuras por palabra
+static inline uint32_t clockSweep(ClockState *clockState) {
+    uint32_t capacity = (uint32_t)clockState->capacity;
+    uint32_t hand = clockState->hand;
+    for (;;) {
+        uint64_t *word = &clockState->referenced[hand >> 6];
+        uint32_t bit = hand & 63;
+        uint32_t span = 64 - bit;                     // Ranuras de esta palabra desde la manecilla
+        if (capacity - hand < span) {
+            span = capacity - hand;                   // La última palabra puede estar incompleta
+        }
+        uint64_t window = span == 64 ? ~0ULL : ((1ULL << span) - 1) << bit;
+        uint64_t clear = ~*word & window;             // Ranuras sin bit de referencia
+        if (clear != 0) {
+            uint32_t victimBit = (uint32_t)__builtin_ctzll(clear);
+            *word &= ~(window & ((1ULL << victimBit) - 1));  // Segunda oportunidad a las anteriores
+            clockState->hand = hand + (victimBit - bit);
+            return clockState->hand;
+        }
+        *word &= ~window;                             // Todas tenían el bit: se apagan de una vez
+        hand += span;
+        if (hand == capacity) {
+            hand = 0;
+        }
+    }
+}
+
+// Función para sumar una referencia al contador de una ranura (GCLOCK), sin pasar del máximo
+static inline void gclockReference(ClockState *clockState, uint32_t slot) {
+    uint64_t *word = &clockState->counts[slot >> 3];
+    uint32_t shift = (slot & 7) * 8;
+    if (((*word >> shift) & 0xFF) < GCLOCK_MAX_COUNT) {
+        *word += 1ULL << shift;
+    }
+}
+
+// Función para avanzar la manecilla hasta una ranura con el contador en 0, restando 1 a los
+// contadores que encuentre antes (GCLOCK); procesa 8 ranuras por palabra: una ranura en 0 se
+// detecta con el truco del byte nulo y, si no hay ninguna, se restan todas de una vez
+static inline uint32_t gclockSweep(ClockState *clockState) {
+    const uint64_t ones = 0x0101010101010101ULL;
+    uint32_t capacity = (uint32_t)clockState->capacity;
+    uint32_t hand = clockState->hand;
+    for (;;) {
+        uint64_t *word = &clockState->counts[hand >> 3];
+        uint32_t byte = hand & 7;
+        uint32_t span = 8 - byte;                     // Ranuras de esta palabra desde la manecilla
+        if (capacity - hand < span) {
+            span = capacity - hand;                   // La última palabra puede estar incompleta
+        }
+        uint64_t window = span == 8 ? ~0ULL : ((1ULL << (8 * span)) - 1) << (8 * byte);
+        uint64_t value = *word | ~window;             // Fuera de la ventana los bytes valen 0xFF
+        uint64_t zero = (value - ones) & ~value & (ones << 7);
+        if (zero != 0) {
+            // El bit más bajo marca exactamente el primer byte nulo
+            uint32_t victimByte = (uint32_t)__builtin_ctzll(zero) >> 3;
+            *word -= ones & window & ((1ULL << (8 * victimByte)) - 1);
+            clockState->hand = hand + (victimByte - byte);
+            return clockState->hand;
+        }
+        *word -= ones & window;                       // Ninguno estaba en 0: se restan de una vez
+        hand += span;
+        if (hand == capacity) {
+            hand = 0;
+        }
+    }
+}
+
+// Función para elegir la ranura de la próxima víctima según la variante del reloj
+static inline uint32_t clockVictimSlot(ClockState *clockState) {
+    return clockState->counts != NULL ? gclockSweep(clockState) : clockSweep(clockState);
+}
+
+// Función para avanzar la manecilla después de reemplazar la página de su ranura
+static inline void clockAdvance(ClockState *clockState) {
+    clockState->hand++;
+    if (clockState->hand == (uint32_t)clockState->capacity) {
+        clockState->hand = 0;
+    }
+}
+
+// Función para expulsar la página de la ranura que señale la manecilla
+static inline PageId clockEvict(void *state) {
+    ClockState *clockState = (ClockState *)state;
+    if (clockState->numFrames == 0) {
+        return NO_PAGE;
+    }
+
+    // Saltar las ranuras vacías que hayan dejado expulsiones anteriores
+    uint32_t slot = clockVictimSlot(clockState);
+    while (clockState->pages[slot] == NO_PAGE) {
+        clockAdvance(clockState);
+        slot = clockVictimSlot(clockState);
+    }
+    PageId page = clockState->pages[slot];
+    if (clockState->index != NULL) {
+        indexRemove(clockState->index, page);
+    }
+    clockState->pages[slot] = NO_PAGE;
+    clockState->freeSlots[clockState->numFree++] = slot;
+    clockState->numFrames--;
+    clockAdvance(clockState);
+    return page;
+}
+
+// Función para quitar una página cargada (común a Clock y GCLOCK); su ranura queda vacía y sin
+// referencias, igual que después de una expulsión
+static inline bool clockRemove(void *state, PageId page) {
+    ClockState *clockState = (ClockState *)state;
+    int found = clockFind(clockState, page);
+    if (found < 0) {
+        return false;
+    }
+    uint32_t slot = (uint32_t)found;
+    if (clockState->index != NULL) {
+        indexRemove(clockState->index, page);
+    }
+    if (clockState->counts != NULL) {
+        clockState->counts[slot >> 3] &= ~(0xFFULL << ((slot & 7) * 8));
+    } else {
+        clockState->referenced[slot >> 6] &= ~(1ULL << (slot & 63));
+    }
+    clockState->pages[slot] = NO_PAGE;
+    clockState->freeSlots[clockState->numFree++] = slot;
+    clockState->numFrames--;
+    return true;
+}
+
+// Función para cargar una página que no está en memoria (común a Clock y GCLOCK)
+static inline void clockLoad(ClockState *clockState, PageId page, PageId *victim) {
+    uint32_t slot;
+    if (clockState->numFree > 0) {
+        // Ocupar una ranura vacía si hay espacio
+        slot = clockState->freeSlots[--clockState->numFree];
+        clockState->numFrames++;
+    } else {
+        // Reemplazar la página usando el algoritmo Clock; la página nueva entra sin bit de
+        // referencia (o con el contador en 0) y la manecilla avanza a la siguiente ranura,
+        // que pasa a ser la más antigua
+        slot = clockVictimSlot(clockState);
+        *victim = clockState->pages[slot];
+        if (clockState->index != NULL) {
+            indexRemove(clockState->index, *victim);
+        }
+        clockAdvance(clockState);
+    }
+    clockState->pages[slot] = page;
+    if (clockState->index != NULL) {
+        indexInsert(clockState->index, page, slot);
+    }
+}
+
+// Función para simular la carga de una página a memoria física utilizando el algoritmo Clock
+static inline bool clockAccess(void *state, PageId page, uint64_t nextUse, PageId *victim) {
+    ClockState *clockState = (ClockState *)state;
+    (void)nextUse;
+
+    // Si la página ya está en memoria solo se enciende su bit de referencia
+    int slot = clockFind(clockState, page);
+    if (slot >= 0) {
+        clockReference(clockState, (uint32_t)slot);
+        return true;
+    }
+    clockLoad(clockState, page, victim);
+    return false;
+}
+
+// Función para simular la carga de una página a memoria física utilizando GCLOCK
+static inline bool gclockAccess(void *state, PageId page, uint64_t nextUse, PageId *victim) {
+    ClockState *clockState = (ClockState *)state;
+    (void)nextUse;
+
+    // Si la página ya está en memoria solo se incrementa su contador
+    int slot = clockFind(clockState, page);
+    if (slot >= 0) {
+        gclockReference(clockState, (uint32_t)slot);
+        return true;
+    }
+    clockLoad(clockState, page, victim);
+    return false;
+}
+
+// Función para imprimir el estado actual del anillo (solo para fines de depuración)
+static inline void clockPrint(void *state) {
+    ClockState *clockState = (ClockState *)state;
+    printf("Estado actual de la lista de frames:\n");
+    for (uint32_t slot = 0; slot < (uint32_t)clockState->capacity; ++slot) {
+        if (clockState->pages[slot] != NO_PAGE) {
+            printf("Página: %lld, ", (long long)clockState->pages[slot]);
+            printf("Estado: Ocupado, ");
+            if (clockState->counts != NULL) {
+                printf("Contador: %d\n", (int)((clockState->counts[slot >> 3] >> ((slot & 7) * 8)) & 0xFF));
+            } else {
+                bool referenced = (clockState->referenced[slot >> 6] >> (slot & 63)) & 1;
+                printf("Referencia: %s\n", referenced ? "1" : "0");
+            }
+        }
+    }
+    printf("\n");
+}
+
+// Función para liberar el estado de la política Clock
+static inline void clockDestroy(void *state) {
+    ClockState *clockState = (ClockState *)state;
+    free(clockState->pages);
+    free(clockState->referenced);
+    free(clockState->counts);
+    free(clockState->freeSlots);
+    destroyPageIndex(clockState->index);
+    free(clockState);
+}
+
+static const PolicyOps clockPolicy = {
+    "clock", "Clock (segunda oportunidad)", false,
+    clockInit, clockAccess, clockEvict, clockRemove, clockPrint, clockDestroy
+};
+
+static const PolicyOps gclockPolicy = {
+    "gclock", "GCLOCK (contadores de referencias)", false,
+    gclockInit, gclockAccess, clockEvict, clockRemove, clockPrint, clockDestroy
+};
+
+#endif
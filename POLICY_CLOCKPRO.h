@@ -0,0 +1,301 @@
+#ifndef POLICY_CLOCKPRO_H
+#define POLICY_CLOCKPRO_H
+
+#include "POLICY.h"
+#include "PAGE_INDEX.h"
+
+// CLOCK-Pro (Jiang, Chen y Zhang): la aproximación de LIRS con un reloj. Un solo anillo guarda
+// páginas calientes (hot), frías residentes (cold) y frías ya expulsadas que siguen en su
+// "periodo de prueba" (test, solo el número de página). Tres manecillas lo recorren:
+//  - hand cold: una fría sin referencia se expulsa y queda en prueba; con referencia pasa a caliente
+//  - hand hot: una caliente sin referencia pasa a fría (así se acota el espacio de las calientes)
+//  - hand test: termina el periodo de prueba de las páginas que no se volvieron a pedir
+// Una página en prueba que se vuelve a pedir entra como caliente y agranda el espacio objetivo de
+// las frías; una prueba que vence lo achica. Un acierto solo enciende el bit de referencia del
+// frame; las páginas nuevas se insertan justo detrás de hand hot (la posición más reciente).
+// Es la versión simplificada (sin periodo de prueba para las frías residentes): cada manecilla
+// avanza una posición por paso sin mover a las otras, y hand hot también termina el periodo de
+// las páginas en prueba que alcanza, como en el artículo.
+// El anillo es una lista circular sobre un arreglo de 2 * capacity frames (capacity residentes
+// y como máximo capacity en prueba) y un solo índice página -> frame.
+// El espacio objetivo de las frías se adapta entre un mínimo y capacity menos ese mínimo: sin el
+// piso se reduce hasta 1 y hand cold recorre casi todo el anillo en cada fallo buscando la única
+// fría; sin el techo lo mismo le pasa a hand hot con las calientes.
+
+#define CLOCKPRO_MIN_PERCENT 1   // Porcentaje mínimo de frames para las frías y para las calientes
+
+enum ClockProType { CLOCKPRO_HOT, CLOCKPRO_COLD, CLOCKPRO_TEST };
+
+// Estado de la política CLOCK-Pro
+typedef struct ClockProState {
+    FrameList *pool;        // Frames del anillo (prev/next circulares; 'referenced' es el bit de referencia)
+    uint8_t *type;          // CLOCKPRO_HOT, CLOCKPRO_COLD o CLOCKPRO_TEST de cada frame
+    PageIndex *index;       // Índice página -> frame, residentes y en prueba
+    uint32_t handHot;       // Manecillas (NIL_FRAME si el anillo está vacío)
+    uint32_t handCold;
+    uint32_t handTest;
+    int numHot;             // Número de páginas calientes
+    int numCold;            // Número de páginas frías residentes
+    int numTest;            // Número de páginas en prueba
+    int coldTarget;         // Espacio objetivo de las frías residentes (coldMin..coldMax)
+    int coldMin;            // Límites del espacio objetivo de las frías
+    int coldMax;
+    int capacity;           // Número máximo de frames residentes
+    PageId victim;          // Última página expulsada por hand cold
+} ClockProState;
+
+// Función para liberar el estado de la política CLOCK-Pro
+static inline void clockProDestroy(void *state) {
+    ClockProState *clockPro = (ClockProState *)state;
+    destroyFrameList(clockPro->pool);
+    destroyPageIndex(clockPro->index);
+    free(clockPro->type);
+    free(clockPro);
+}
+
+// Función para crear el estado de la política CLOCK-Pro
+static inline void* clockProInit(int capacity) {
+    ClockProState *clockPro = (ClockProState *)calloc(1, sizeof(ClockProState));
+    if (clockPro == NULL) {
+        return NULL;
+    }
+    clockPro->pool = createFrameList(2 * capacity + 1);
+    clockPro->type = (uint8_t *)malloc(((size_t)2 * capacity + 1) * sizeof(uint8_t));
+    clockPro->index = createPageIndex(2 * (uint64_t)capacity + 1);
+    if (clockPro->pool == NULL || clockPro->type == NULL || clockPro->index == NULL) {
+        clockProDestroy(clockPro);
+        return NULL;
+    }
+    clockPro->handHot = NIL_FRAME;
+    clockPro->handCold = NIL_FRAME;
+    clockPro->handTest = NIL_FRAME;
+    // Al menos un frame para las frías; con un solo frame no queda espacio para las calientes
+    clockPro->coldMin = capacity * CLOCKPRO_MIN_PERCENT / 100 > 1 ? capacity * CLOCKPRO_MIN_PERCENT / 100 : 1;
+    clockPro->coldMax = capacity - clockPro->coldMin > clockPro->coldMin ? capacity - clockPro->coldMin : clockPro->coldMin;
+    clockPro->coldTarget = clockPro->coldMax;
+    clockPro->capacity = capacity;
+    return clockPro;
+}
+
+// Función para insertar un frame en el anillo justo antes de hand hot
+static inline void clockProLink(ClockProState *clockPro, uint32_t frame) {
+    Frame *f = frameAt(clockPro->pool, frame);
+    if (clockPro->handHot == NIL_FRAME) {
+        f->prev = frame;
+        f->next = frame;
+        clockPro->handHot = frame;
+        clockPro->handCold = frame;
+        clockPro->handTest = frame;
+        return;
+    }
+    Frame *hot = frameAt(clockPro->pool, clockPro->handHot);
+    f->next = clockPro->handHot;
+    f->prev = hot->prev;
+    frameAt(clockPro->pool, hot->prev)->next = frame;
+    hot->prev = frame;
+}
+
+// Función para sacar un frame del anillo; las manecillas que lo señalan retroceden al anterior
+static inline void clockProUnlink(ClockProState *clockPro, uint32_t frame) {
+    Frame *f = frameAt(clockPro->pool, frame);
+    if (f->next == frame) {
+        clockPro->handHot = NIL_FRAME;
+        clockPro->handCold = NIL_FRAME;
+        clockPro->handTest = NIL_FRAME;
+        return;
+    }
+    if (clockPro->handHot == frame) clockPro->handHot = f->prev;
+    if (clockPro->handCold == frame) clockPro->handCold = f->prev;
+    if (clockPro->handTest == frame) clockPro->handTest = f->prev;
+    frameAt(clockPro->pool, f->prev)->next = f->next;
+    frameAt(clockPro->pool, f->next)->prev = f->prev;
+}
+
+// Función para olvidar una página en prueba
+static inline void clockProForget(ClockProState *clockPro, uint32_t frame) {
+    clockProUnlink(clockPro, frame);
+    indexRemove(clockPro->index, frameAt(clockPro->pool, frame)->page);
+    freeFrame(clockPro->pool, frame);
+    clockPro->numTest--;
+}
+
+// Función para terminar el periodo de prueba de una página: se olvida y el espacio de las frías
+// se achica, porque la página no volvió a pedirse a tiempo
+static inline void clockProExpire(ClockProState *clockPro, uint32_t frame) {
+    clockProForget(clockPro, frame);
+    if (clockPro->coldTarget > clockPro->coldMin) {
+        clockPro->coldTarget--;
+    }
+}
+
+// Función para avanzar hand test una posición, terminando el periodo de prueba que encuentre
+static inline void clockProRunHandTest(ClockProState *clockPro) {
+    if (clockPro->type[clockPro->handTest] == CLOCKPRO_TEST) {
+        clockProExpire(clockPro, clockPro->handTest);
+    }
+    clockPro->handTest = frameAt(clockPro->pool, clockPro->handTest)->next;
+}
+
+// Función para avanzar hand hot una posición: una caliente con referencia pierde el bit y una sin
+// referencia pasa a fría; una página en prueba que alcanza termina su periodo
+static inline void clockProRunHandHot(ClockProState *clockPro) {
+    uint32_t frame = clockPro->handHot;
+    Frame *f = frameAt(clockPro->pool, frame);
+    if (clockPro->type[frame] == CLOCKPRO_HOT) {
+        if (f->referenced) {
+            f->referenced = false;
+        } else {
+            clockPro->type[frame] = CLOCKPRO_COLD;
+            clockPro->numHot--;
+            clockPro->numCold++;
+        }
+    } else if (clockPro->type[frame] == CLOCKPRO_TEST) {
+        clockProExpire(clockPro, frame);
+    }
+    clockPro->handHot = frameAt(clockPro->pool, clockPro->handHot)->next;
+}
+
+// Función para avanzar hand cold una posición: una fría con referencia pasa a caliente y una sin
+// referencia se expulsa y queda en prueba
+static inline void clockProRunHandCold(ClockProState *clockPro) {
+    uint32_t frame = clockPro->handCold;
+    Frame *f = frameAt(clockPro->pool, frame);
+    if (clockPro->type[frame] == CLOCKPRO_COLD) {
+        if (f->referenced) {
+            f->referenced = false;
+            clockPro->type[frame] = CLOCKPRO_HOT;
+            clockPro->numCold--;
+            clockPro->numHot++;
+        } else {
+            clockPro->type[frame] = CLOCKPRO_TEST;
+            f->valid = false;
+            clockPro->victim = f->page;
+            clockPro->numCold--;
+            clockPro->numTest++;
+        }
+    }
+    clockPro->handCold = f->next;
+}
+
+// Función para mover las manecillas hasta que haya un frame libre: hand cold avanza y, después de
+// cada paso, hand test acota las páginas en prueba y hand hot el espacio de las calientes
+static inline void clockProReclaim(ClockProState *clockPro) {
+    while (clockPro->numHot + clockPro->numCold >= clockPro->capacity) {
+        clockProRunHandCold(clockPro);
+        while (clockPro->numTest > clockPro->capacity) {
+            clockProRunHandTest(clockPro);
+        }
+        while (clockPro->numHot > clockPro->capacity - clockPro->coldTarget) {
+            clockProRunHandHot(clockPro);
+        }
+    }
+}
+
+// Función para expulsar una página elegida por CLOCK-Pro
+static inline PageId clockProEvict(void *state) {
+    ClockProState *clockPro = (ClockProState *)state;
+    if (clockPro->numHot + clockPro->numCold == 0) {
+        return NO_PAGE;
+    }
+    clockPro->victim = NO_PAGE;
+    while (clockPro->victim == NO_PAGE) {
+        if (clockPro->numCold == 0) {
+            clockProRunHandHot(clockPro);
+        } else {
+            clockProRunHandCold(clockPro);
+        }
+    }
+    while (clockPro->numTest > clockPro->capacity) {
+        clockProRunHandTest(clockPro);
+    }
+    return clockPro->victim;
+}
+
+// Función para quitar una página residente; no queda en prueba porque CLOCK-Pro no la eligió
+static inline bool clockProRemove(void *state, PageId page) {
+    ClockProState *clockPro = (ClockProState *)state;
+    uint64_t *value = indexFind(clockPro->index, page);
+    if (value == NULL) {
+        return false;
+    }
+    uint32_t frame = (uint32_t)*value;
+    if (clockPro->type[frame] == CLOCKPRO_TEST) {
+        return false;
+    }
+    if (clockPro->type[frame] == CLOCKPRO_HOT) {
+        clockPro->numHot--;
+    } else {
+        clockPro->numCold--;
+    }
+    clockProUnlink(clockPro, frame);
+    indexRemove(clockPro->index, page);
+    freeFrame(clockPro->pool, frame);
+    return true;
+}
+
+// Función para simular la carga de una página a memoria física utilizando CLOCK-Pro
+static inline bool clockProAccess(void *state, PageId page, uint64_t nextUse, PageId *victim) {
+    ClockProState *clockPro = (ClockProState *)state;
+    (void)nextUse;
+    uint64_t *value = indexFind(clockPro->index, page);
+    uint32_t frame = NIL_FRAME;
+    if (value != NULL) {
+        frame = (uint32_t)*value;
+        if (clockPro->type[frame] != CLOCKPRO_TEST) {
+            frameAt(clockPro->pool, frame)->referenced = true;
+            return true;
+        }
+        // Fallo durante el periodo de prueba: la página vuelve como caliente
+        if (clockPro->coldTarget < clockPro->coldMax) {
+            clockPro->coldTarget++;
+        }
+        clockProUnlink(clockPro, frame);
+        clockPro->numTest--;
+    } else {
+        frame = createFrame(clockPro->pool);
+        frameAt(clockPro->pool, frame)->page = page;
+        indexInsert(clockPro->index, page, frame);
+    }
+
+    // Liberar un frame antes de insertar; la página que se carga ya no está en el anillo
+    clockPro->victim = NO_PAGE;
+    clockProReclaim(clockPro);
+    *victim = clockPro->victim;
+
+    Frame *f = frameAt(clockPro->pool, frame);
+    f->valid = true;
+    f->referenced = false;
+    if (value != NULL) {
+        clockPro->type[frame] = CLOCKPRO_HOT;
+        clockPro->numHot++;
+    } else {
+        clockPro->type[frame] = CLOCKPRO_COLD;
+        clockPro->numCold++;
+    }
+    clockProLink(clockPro, frame);
+    return false;
+}
+
+// Función para imprimir el anillo de CLOCK-Pro desde hand hot (solo para fines de depuración)
+static inline void clockProPrint(void *state) {
+    ClockProState *clockPro = (ClockProState *)state;
+    static const char *const types[] = {"caliente", "fría", "prueba"};
+    printf("Estado actual de CLOCK-Pro (calientes %d, frías %d, en prueba %d, objetivo de frías %d):\n",
+           clockPro->numHot, clockPro->numCold, clockPro->numTest, clockPro->coldTarget);
+    uint32_t current = clockPro->handHot;
+    for (int i = 0; current != NIL_FRAME && (i == 0 || current != clockPro->handHot); ++i) {
+        Frame *f = frameAt(clockPro->pool, current);
+        printf("Página: %lld, Tipo: %s, Referencia: %s%s%s%s\n", (long long)f->page, types[clockPro->type[current]],
+               f->referenced ? "1" : "0", current == clockPro->handHot ? " <- hot" : "",
+               current == clockPro->handCold ? " <- cold" : "", current == clockPro->handTest ? " <- test" : "");
+        current = f->next;
+    }
+    printf("\n");
+}
+
+static const PolicyOps clockProPolicy = {
+    "clockpro", "CLOCK-Pro (manecillas hot/cold/test)", false,
+    clockProInit, clockProAccess, clockProEvict, clockProRemove, clockProPrint, clockProDestroy
+};
+
+#endif
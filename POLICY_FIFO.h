@@ -0,0 +1,187 @@
+#ifndef POLICY_FIFO_H
+#define POLICY_FIFO_H
+
+#include "POLICY.h"
+#include "PAGE_INDEX.h"
+#include "SMALL_SET.h"
+
+// Estado de la política FIFO: un anillo de ranuras en orden de llegada; 'oldest' es la ranura
+// de la página más antigua (la siguiente en salir) y las nuevas se cargan 'used' ranuras después.
+// Quitar una página que no es la más antigua (fifoRemove) deja un hueco (NO_PAGE) en su ranura y
+// 'used' cuenta también los huecos. Con el índice el anillo tiene 2 * capacity ranuras y se
+// compacta solo cuando los huecos lo llenan, como mucho una vez cada capacity cargas.
+// Con pocos frames los aciertos se detectan recorriendo las ranuras (SMALL_SET.h) en lugar del
+// índice, y el anillo son esas mismas ranuras
+typedef struct FifoState {
+    PageId *pages;      // Página de cada ranura del anillo (NO_PAGE si está vacía)
+    uint32_t oldest;    // Ranura de la página más antigua
+    uint32_t used;      // Ranuras desde 'oldest' hasta la última página cargada, huecos incluidos
+    uint32_t ringSize;  // Ranuras del anillo
+    int numFrames;      // Número de frames actualmente ocupados
+    int capacity;       // Número máximo de frames
+    PageIndex *index;   // Índice página -> ranura (NULL en el modo de conjunto pequeño)
+    SmallSetFind find;  // Búsqueda en el conjunto pequeño (NULL si se usa el índice)
+    int slots;          // Ranuras que recorre la búsqueda (capacity más el relleno)
+} FifoState;
+
+// Función para crear el estado de la política FIFO
+static inline void* fifoInit(int capacity) {
+    FifoState *fifo = (FifoState *)calloc(1, sizeof(FifoState));
+    if (fifo == NULL) {
+        return NULL;
+    }
+    fifo->capacity = capacity;
+    if (capacity <= SMALL_SET_MAX_FRAMES) {
+        fifo->find = smallSetBestFind();
+        fifo->slots = smallSetSlots(capacity);
+        fifo->ringSize = (uint32_t)fifo->slots;
+    } else {
+        fifo->index = createPageIndex(capacity);
+        fifo->ringSize = 2 * (uint32_t)capacity;
+    }
+    fifo->pages = createSmallSet((int)fifo->ringSize);
+    if (fifo->pages == NULL || (fifo->find == NULL && fifo->index == NULL)) {
+        free(fifo->pages);
+        destroyPageIndex(fifo->index);
+        free(fifo);
+        return NULL;
+    }
+    return fifo;
+}
+
+// Función para obtener la ranura que está 'offset' ranuras después de 'slot' en el anillo
+static inline uint32_t fifoSlot(FifoState *fifo, uint32_t slot, uint32_t offset) {
+    slot += offset;
+    return slot >= fifo->ringSize ? slot - fifo->ringSize : slot;
+}
+
+// Función para buscar la ranura de una página (-1 si no está en memoria)
+static inline int fifoFind(FifoState *fifo, PageId page) {
+    if (fifo->find != NULL) {
+        return fifo->find(fifo->pages, fifo->slots, page);
+    }
+    uint64_t *value = indexFind(fifo->index, page);
+    return value != NULL ? (int)*value : -1;
+}
+
+// Función para saltar los huecos del principio del anillo (hay huecos solo si used > numFrames)
+static inline void fifoSkipHoles(FifoState *fifo) {
+    while (fifo->used > (uint32_t)fifo->numFrames && fifo->pages[fifo->oldest] == NO_PAGE) {
+        fifo->oldest = fifoSlot(fifo, fifo->oldest, 1);
+        fifo->used--;
+    }
+}
+
+// Función para juntar las páginas desde 'oldest' sin huecos, en el mismo orden
+static inline void fifoCompact(FifoState *fifo) {
+    uint32_t to = 0;
+    for (uint32_t from = 0; from < fifo->used; ++from) {
+        uint32_t slot = fifoSlot(fifo, fifo->oldest, from);
+        PageId page = fifo->pages[slot];
+        if (page == NO_PAGE) {
+            continue;
+        }
+        if (to != from) {
+            uint32_t target = fifoSlot(fifo, fifo->oldest, to);
+            fifo->pages[target] = page;
+            fifo->pages[slot] = NO_PAGE;
+            if (fifo->index != NULL) {
+                *indexFind(fifo->index, page) = target;
+            }
+        }
+        to++;
+    }
+    fifo->used = to;
+}
+
+// Función para expulsar la página más antigua (la de la ranura 'oldest')
+static inline PageId fifoEvict(void *state) {
+    FifoState *fifo = (FifoState *)state;
+    if (fifo->numFrames == 0) {
+        return NO_PAGE;
+    }
+    PageId page = fifo->pages[fifo->oldest];
+    if (fifo->index != NULL) {
+        indexRemove(fifo->index, page);
+    }
+    fifo->pages[fifo->oldest] = NO_PAGE;
+    fifo->oldest = fifoSlot(fifo, fifo->oldest, 1);
+    fifo->used--;
+    fifo->numFrames--;
+    fifoSkipHoles(fifo);
+    return page;
+}
+
+// Función para quitar una página cargada; si no era la más antigua ni la más nueva deja un hueco
+static inline bool fifoRemove(void *state, PageId page) {
+    FifoState *fifo = (FifoState *)state;
+    int slot = fifoFind(fifo, page);
+    if (slot < 0) {
+        return false;
+    }
+    if (fifo->index != NULL) {
+        indexRemove(fifo->index, page);
+    }
+    fifo->pages[slot] = NO_PAGE;
+    fifo->numFrames--;
+    fifoSkipHoles(fifo);
+    while (fifo->used > (uint32_t)fifo->numFrames && fifo->pages[fifoSlot(fifo, fifo->oldest, fifo->used - 1)] == NO_PAGE) {
+        fifo->used--; // Huecos al final: la próxima página se carga justo después de la última
+    }
+    return true;
+}
+
+// Función para simular la carga de una página a memoria física utilizando FIFO
+static inline bool fifoAccess(void *state, PageId page, uint64_t nextUse, PageId *victim) {
+    FifoState *fifo = (FifoState *)state;
+    (void)nextUse;
+    if (fifoFind(fifo, page) >= 0) {
+        return true; // La página ya está en memoria, no se hace nada
+    }
+
+    // Si ya están ocupados todos los frames, reemplazar la página más antigua
+    if (fifo->numFrames == fifo->capacity) {
+        *victim = fifoEvict(fifo);
+    }
+    if (fifo->used == fifo->ringSize) {
+        fifoCompact(fifo); // Quedan frames libres, pero son huecos dentro del anillo
+    }
+
+    uint32_t slot = fifoSlot(fifo, fifo->oldest, fifo->used);
+    fifo->pages[slot] = page;
+    fifo->numFrames++;
+    fifo->used++;
+    if (fifo->index != NULL) {
+        indexInsert(fifo->index, page, slot);
+    }
+    return false;
+}
+
+// Función para imprimir los frames de la política FIFO, del más antiguo al más nuevo
+static inline void fifoPrint(void *state) {
+    FifoState *fifo = (FifoState *)state;
+    printf("Estado actual de la lista de frames:\n");
+    for (uint32_t i = 0; i < fifo->used; ++i) {
+        PageId page = fifo->pages[fifoSlot(fifo, fifo->oldest, i)];
+        if (page != NO_PAGE) {
+            printf("Página: %lld, ", (long long)page);
+            printf("Estado: Ocupado\n");
+        }
+    }
+    printf("\n");
+}
+
+// Función para liberar el estado de la política FIFO
+static inline void fifoDestroy(void *state) {
+    FifoState *fifo = (FifoState *)state;
+    free(fifo->pages);
+    destroyPageIndex(fifo->index);
+    free(fifo);
+}
+
+static const PolicyOps fifoPolicy = {
+    "fifo", "FIFO (primera en entrar, primera en salir)", false,
+    fifoInit, fifoAccess, fifoEvict, fifoRemove, fifoPrint, fifoDestroy
+};
+
+#endif
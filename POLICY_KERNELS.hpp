@@ -0,0 +1,243 @@
+#ifndef POLICY_KERNELS_HPP
+#define POLICY_KERNELS_HPP
+
+#include <stdint.h>
+#include <string.h>
+#include <limits>
+#include <utility>
+#include "POLICY.h"
+
+// Núcleos de FIFO, LRU y Clock especializados en tiempo de compilación (solo C++): el número de
+// frames, el ancho del identificador de página (uint16_t, uint32_t o uint64_t) y la política son
+// parámetros de plantilla. Con el tamaño constante los recorridos de las ranuras se desenrollan
+// por completo, el módulo del anillo se vuelve una comparación, y el estado es un arreglo fijo que
+// vive en el marco del ciclo de simulación (sin punteros a memoria dinámica ni llamadas por
+// puntero). Con el menor ancho en el que quepan las páginas de la traza el estado ocupa menos.
+// Cada núcleo simula exactamente lo mismo que la política genérica del mismo nombre (mismos
+// aciertos y mismas víctimas). Solo se instancian tamaños pequeños: con más frames la búsqueda
+// lineal ya cuesta más que el índice de las políticas genéricas, que se usan en su lugar. El
+// límite de cada política es donde se cruzan las dos (ver KERNELS.C): LRU lo alcanza antes
+// porque en cada fallo también busca el mínimo de los instantes de uso.
+
+#define KERNEL_MAX_FRAMES 32   // Mayor número de frames con núcleos especializados (cualquier política)
+
+enum KernelPolicy { KERNEL_FIFO, KERNEL_LRU, KERNEL_CLOCK, KERNEL_POLICIES };
+
+static const char *const kernelPolicyNames[] = {"fifo", "lru", "clock"};
+
+// Mayor número de frames con núcleo especializado de cada política (ninguno pasa de KERNEL_MAX_FRAMES)
+static constexpr int kernelMaxFrames[] = {32, 16, 24};
+
+// Anchos de identificador instanciados, de menor a mayor
+enum KernelWidth { KERNEL_U16, KERNEL_U32, KERNEL_U64, KERNEL_WIDTHS };
+
+static const int kernelWidthBits[] = {16, 32, 64};
+
+// Función para simular una traza completa con un núcleo; devuelve el número de aciertos
+typedef uint64_t (*KernelRun)(const PageId *trace, uint64_t count);
+
+// Función para buscar una página en las ranuras; devuelve la ranura o -1 si no está. Como en
+// SMALL_SET.h se comparan todas las ranuras y se arma una máscara en lugar de salir en el primer
+// acierto, así no hay saltos que dependan de la página
+template <typename Id, int Frames>
+static inline int kernelFind(const Id (&pages)[Frames], Id page) {
+    uint64_t mask = 0;
+#pragma GCC unroll 64
+    for (int i = 0; i < Frames; ++i) {
+        mask |= (uint64_t)(pages[i] == page) << i;
+    }
+    return mask != 0 ? __builtin_ctzll(mask) : -1;
+}
+
+// FIFO: anillo de ranuras que se ocupan en orden; la más antigua es la siguiente a reemplazar
+template <typename Id, int Frames>
+struct FifoKernel {
+    Id pages[Frames];
+    int oldest;             // Ranura de la página más antigua
+
+    void reset() {
+        for (int i = 0; i < Frames; ++i) {
+            pages[i] = std::numeric_limits<Id>::max();
+        }
+        oldest = 0;
+    }
+
+    bool access(Id page) {
+        if (kernelFind(pages, page) >= 0) {
+            return true;
+        }
+        // Las ranuras vacías también se ocupan en orden, así que llenar y reemplazar es lo mismo
+        pages[oldest] = page;
+        oldest = oldest + 1 == Frames ? 0 : oldest + 1;
+        return false;
+    }
+};
+
+// LRU: cada ranura guarda el instante de su último uso y la víctima es la de instante menor (las
+// vacías tienen instante 0 y se ocupan en orden porque gana la primera de las menores)
+template <typename Id, int Frames>
+struct LruKernel {
+    Id pages[Frames];
+    uint64_t lastUse[Frames];
+    uint64_t now;           // Instante del acceso actual
+
+    void reset() {
+        for (int i = 0; i < Frames; ++i) {
+            pages[i] = std::numeric_limits<Id>::max();
+            lastUse[i] = 0;
+        }
+        now = 0;
+    }
+
+    bool access(Id page) {
+        now++;
+        int slot = kernelFind(pages, page);
+        if (slot >= 0) {
+            lastUse[slot] = now;
+            return true;
+        }
+        int victim = 0;
+#pragma GCC unroll 64
+        for (int i = 1; i < Frames; ++i) {
+            victim = lastUse[i] < lastUse[victim] ? i : victim;
+        }
+        pages[victim] = page;
+        lastUse[victim] = now;
+        return false;
+    }
+};
+
+// Clock: los bits de referencia caben en una palabra, así que el barrido de la manecilla se
+// resuelve con máscaras en lugar de recorrer las ranuras (igual que clockSweep en POLICY_CLOCK.h)
+template <typename Id, int Frames>
+struct ClockKernel {
+    static_assert(Frames <= 64, "Los bits de referencia deben caber en una palabra");
+    static constexpr uint64_t all = Frames == 64 ? ~0ULL : (1ULL << Frames) - 1;
+
+    Id pages[Frames];
+    uint64_t referenced;    // Bit de referencia de cada ranura
+    int hand;               // Ranura señalada por la manecilla
+    int used;               // Ranuras ocupadas (se ocupan en orden)
+
+    void reset() {
+        for (int i = 0; i < Frames; ++i) {
+            pages[i] = std::numeric_limits<Id>::max();
+        }
+        referenced = 0;
+        hand = 0;
+        used = 0;
+    }
+
+    bool access(Id page) {
+        int slot = kernelFind(pages, page);
+        if (slot >= 0) {
+            referenced |= 1ULL << slot;
+            return true;
+        }
+        if (used < Frames) {
+            pages[used++] = page;
+            return false;
+        }
+
+        // La víctima es la primera ranura sin bit de referencia desde la manecilla (dando la
+        // vuelta); las que tenían el bit y se pasaron pierden su segunda oportunidad
+        uint64_t clear = ~referenced & all;
+        uint64_t ahead = clear & (all << hand);
+        int victim;
+        if (ahead != 0) {
+            victim = __builtin_ctzll(ahead);
+            referenced &= ~((1ULL << victim) - 1) | ((1ULL << hand) - 1);
+        } else if (clear != 0) {
+            victim = __builtin_ctzll(clear);
+            referenced &= ((1ULL << hand) - 1) & ~((1ULL << victim) - 1);
+        } else {
+            victim = hand;                      // Todas tenían el bit: se apagan y gana la manecilla
+            referenced = 0;
+        }
+        pages[victim] = page;                   // La página nueva entra sin bit de referencia
+        hand = victim + 1 == Frames ? 0 : victim + 1;
+        return false;
+    }
+};
+
+// Función para simular una traza con un núcleo; el núcleo es una variable local del ciclo
+template <typename Kernel, typename Id>
+static uint64_t runKernel(const PageId *trace, uint64_t count) {
+    Kernel kernel;
+    kernel.reset();
+    uint64_t hits = 0;
+    for (uint64_t t = 0; t < count; ++t) {
+        hits += kernel.access((Id)trace[t]);
+    }
+    return hits;
+}
+
+// Función para obtener los núcleos de una política y un ancho para 1..Limit frames (la entrada i
+// es la de i + 1 frames)
+template <template <typename, int> class Kernel, typename Id, size_t... Sizes>
+static inline const KernelRun* kernelRow(std::index_sequence<Sizes...>) {
+    static const KernelRun row[] = {runKernel<Kernel<Id, (int)Sizes + 1>, Id>...};
+    return row;
+}
+
+// Función para obtener los núcleos de una política para el ancho indicado
+template <template <typename, int> class Kernel, int Limit>
+static inline const KernelRun* kernelRow(int width) {
+    static_assert(Limit <= KERNEL_MAX_FRAMES, "Límite mayor que KERNEL_MAX_FRAMES");
+    typedef std::make_index_sequence<Limit> Sizes;
+    switch (width) {
+        case KERNEL_U16:
+            return kernelRow<Kernel, uint16_t>(Sizes());
+        case KERNEL_U32:
+            return kernelRow<Kernel, uint32_t>(Sizes());
+        default:
+            return kernelRow<Kernel, uint64_t>(Sizes());
+    }
+}
+
+// Función para buscar una política por nombre entre las que tienen núcleos; devuelve -1 si no está
+static inline int findKernelPolicy(const char *name) {
+    for (int p = 0; p < KERNEL_POLICIES; ++p) {
+        if (strcmp(kernelPolicyNames[p], name) == 0) {
+            return p;
+        }
+    }
+    return -1;
+}
+
+// Función para elegir el menor ancho en el que caben todas las páginas de la traza (el valor
+// máximo de cada ancho se reserva para marcar las ranuras vacías). Devuelve KERNEL_WIDTHS si la
+// traza tiene páginas negativas, que están reservadas (el máximo de 64 bits es NO_PAGE): no hay
+// núcleo para ella y findKernel devuelve NULL
+static inline int kernelWidth(const PageId *trace, uint64_t count) {
+    uint64_t maxPage = 0;
+    for (uint64_t t = 0; t < count; ++t) {
+        maxPage = (uint64_t)trace[t] > maxPage ? (uint64_t)trace[t] : maxPage;
+    }
+    if (maxPage > (uint64_t)INT64_MAX) {
+        return KERNEL_WIDTHS;
+    }
+    if (maxPage < UINT16_MAX) {
+        return KERNEL_U16;
+    }
+    return maxPage < UINT32_MAX ? KERNEL_U32 : KERNEL_U64;
+}
+
+// Función para elegir el núcleo de una política, un número de frames y un ancho; devuelve NULL si
+// no hay uno instanciado (y entonces se usa la política genérica, que rechaza las páginas reservadas)
+static inline KernelRun findKernel(int policy, int frames, int width) {
+    if (policy < 0 || policy >= KERNEL_POLICIES || width < 0 || width >= KERNEL_WIDTHS || frames < 1 ||
+        frames > kernelMaxFrames[policy]) {
+        return NULL;
+    }
+    switch (policy) {
+        case KERNEL_FIFO:
+            return kernelRow<FifoKernel, kernelMaxFrames[KERNEL_FIFO]>(width)[frames - 1];
+        case KERNEL_LRU:
+            return kernelRow<LruKernel, kernelMaxFrames[KERNEL_LRU]>(width)[frames - 1];
+        default:
+            return kernelRow<ClockKernel, kernelMaxFrames[KERNEL_CLOCK]>(width)[frames - 1];
+    }
+}
+
+#endif
@@ -0,0 +1,237 @@
+#ifndef POLICY_LFU_H
+#define POLICY_LFU_H
+
+#include "POLICY.h"
+#include "PAGE_INDEX.h"
+
+// LFU en O(1): los frames se agrupan por frecuencia en grupos doblemente enlazados en orden
+// creciente de frecuencia, y dentro de cada grupo los frames están ordenados por recencia.
+// Un acierto mueve el frame al grupo siguiente (frecuencia + 1) y la víctima es el frame menos
+// recientemente usado del primer grupo, así que los empates de frecuencia se resuelven por LRU.
+
+#define NIL_BUCKET UINT32_MAX   // Índice nulo de grupo
+
+// Grupo de frames con la misma frecuencia de acceso
+typedef struct FreqBucket {
+    int frequency;      // Frecuencia de todos los frames del grupo
+    uint32_t head;      // Frame menos recientemente usado del grupo
+    uint32_t tail;      // Frame más recientemente usado del grupo
+    uint32_t prev;      // Grupo con la frecuencia inmediatamente menor
+    uint32_t next;      // Grupo con la frecuencia inmediatamente mayor (o siguiente grupo libre)
+} FreqBucket;
+
+// Estado de la política LFU
+typedef struct LfuState {
+    FrameList *frames;      // Arreglo de frames (los enlaces prev/next son dentro de cada grupo)
+    FreqBucket *buckets;    // Arreglo de grupos (como máximo uno por frame más uno en tránsito)
+    uint32_t *bucketOf;     // Grupo al que pertenece cada frame
+    uint32_t firstBucket;   // Grupo de menor frecuencia
+    uint32_t freeBuckets;   // Primer grupo libre
+    PageIndex *index;       // Índice página -> frame para encontrar un frame en O(1)
+    int numFrames;          // Número de frames ocupados
+    int capacity;           // Número máximo de frames
+} LfuState;
+
+// Función para crear el estado de la política LFU
+static inline void* lfuInit(int capacity) {
+    LfuState *lfu = (LfuState *)malloc(sizeof(LfuState));
+    if (lfu == NULL) {
+        return NULL;
+    }
+    lfu->frames = createFrameList(capacity);
+    lfu->buckets = (FreqBucket *)malloc(((size_t)capacity + 1) * sizeof(FreqBucket));
+    lfu->bucketOf = (uint32_t *)malloc(((size_t)capacity > 0 ? (size_t)capacity : 1) * sizeof(uint32_t));
+    lfu->index = createPageIndex(capacity);
+    lfu->numFrames = 0;
+    lfu->capacity = capacity;
+    if (lfu->frames == NULL || lfu->buckets == NULL || lfu->bucketOf == NULL || lfu->index == NULL) {
+        destroyFrameList(lfu->frames);
+        free(lfu->buckets);
+        free(lfu->bucketOf);
+        destroyPageIndex(lfu->index);
+        free(lfu);
+        return NULL;
+    }
+
+    // Encadenar todos los grupos en la lista de libres
+    for (int i = 0; i <= capacity; ++i) {
+        lfu->buckets[i].next = i < capacity ? (uint32_t)(i + 1) : NIL_BUCKET;
+    }
+    lfu->freeBuckets = 0;
+    lfu->firstBucket = NIL_BUCKET;
+    return lfu;
+}
+
+// Función para crear un grupo vacío con frecuencia 'frequency' justo después de 'prev'
+// (prev = NIL_BUCKET lo inserta al principio)
+static inline uint32_t lfuCreateBucket(LfuState *lfu, int frequency, uint32_t prev) {
+    uint32_t bucket = lfu->freeBuckets;
+    FreqBucket *b = &lfu->buckets[bucket];
+    lfu->freeBuckets = b->next;
+
+    b->frequency = frequency;
+    b->head = NIL_FRAME;
+    b->tail = NIL_FRAME;
+    b->prev = prev;
+    b->next = prev != NIL_BUCKET ? lfu->buckets[prev].next : lfu->firstBucket;
+    if (b->next != NIL_BUCKET) {
+        lfu->buckets[b->next].prev = bucket;
+    }
+    if (prev != NIL_BUCKET) {
+        lfu->buckets[prev].next = bucket;
+    } else {
+        lfu->firstBucket = bucket;
+    }
+    return bucket;
+}
+
+// Función para quitar un grupo vacío de la lista de grupos y devolverlo a la lista de libres
+static inline void lfuRemoveBucket(LfuState *lfu, uint32_t bucket) {
+    FreqBucket *b = &lfu->buckets[bucket];
+    if (b->prev != NIL_BUCKET) {
+        lfu->buckets[b->prev].next = b->next;
+    } else {
+        lfu->firstBucket = b->next;
+    }
+    if (b->next != NIL_BUCKET) {
+        lfu->buckets[b->next].prev = b->prev;
+    }
+    b->next = lfu->freeBuckets;
+    lfu->freeBuckets = bucket;
+}
+
+// Función para agregar un frame como el más recientemente usado de un grupo
+static inline void lfuLinkFrame(LfuState *lfu, uint32_t bucket, uint32_t frame) {
+    FreqBucket *b = &lfu->buckets[bucket];
+    Frame *f = frameAt(lfu->frames, frame);
+    f->prev = b->tail;
+    f->next = NIL_FRAME;
+    if (b->tail != NIL_FRAME) {
+        frameAt(lfu->frames, b->tail)->next = frame;
+    } else {
+        b->head = frame; // Grupo vacío
+    }
+    b->tail = frame;
+    f->frequency = b->frequency;
+    lfu->bucketOf[frame] = bucket;
+}
+
+// Función para desenlazar un frame de su grupo; si el grupo queda vacío se elimina
+static inline void lfuUnlinkFrame(LfuState *lfu, uint32_t frame) {
+    uint32_t bucket = lfu->bucketOf[frame];
+    FreqBucket *b = &lfu->buckets[bucket];
+    Frame *f = frameAt(lfu->frames, frame);
+    if (f->prev != NIL_FRAME) {
+        frameAt(lfu->frames, f->prev)->next = f->next;
+    } else {
+        b->head = f->next;
+    }
+    if (f->next != NIL_FRAME) {
+        frameAt(lfu->frames, f->next)->prev = f->prev;
+    } else {
+        b->tail = f->prev;
+    }
+    if (b->head == NIL_FRAME) {
+        lfuRemoveBucket(lfu, bucket);
+    }
+}
+
+// Función para expulsar el frame menos recientemente usado entre los de menor frecuencia
+static inline PageId lfuEvict(void *state) {
+    LfuState *lfu = (LfuState *)state;
+    if (lfu->firstBucket == NIL_BUCKET) {
+        return NO_PAGE;
+    }
+    uint32_t lfuFrame = lfu->buckets[lfu->firstBucket].head;
+    PageId page = frameAt(lfu->frames, lfuFrame)->page;
+    lfuUnlinkFrame(lfu, lfuFrame);
+    indexRemove(lfu->index, page);
+    freeFrame(lfu->frames, lfuFrame);
+    lfu->numFrames--;
+    return page;
+}
+
+// Función para quitar una página cargada
+static inline bool lfuRemove(void *state, PageId page) {
+    LfuState *lfu = (LfuState *)state;
+    uint64_t *value = indexFind(lfu->index, page);
+    if (value == NULL) {
+        return false;
+    }
+    uint32_t frame = (uint32_t)*value;
+    lfuUnlinkFrame(lfu, frame);
+    indexRemove(lfu->index, page);
+    freeFrame(lfu->frames, frame);
+    lfu->numFrames--;
+    return true;
+}
+
+// Función para simular la carga de una página a memoria física utilizando el algoritmo LFU
+static inline bool lfuAccess(void *state, PageId page, uint64_t nextUse, PageId *victim) {
+    LfuState *lfu = (LfuState *)state;
+    (void)nextUse;
+    uint64_t *value = indexFind(lfu->index, page);
+    if (value != NULL) {
+        // Si la página ya está en memoria, pasarla al grupo con frecuencia + 1
+        uint32_t frame = (uint32_t)*value;
+        uint32_t bucket = lfu->bucketOf[frame];
+        int frequency = lfu->buckets[bucket].frequency + 1;
+        uint32_t next = lfu->buckets[bucket].next;
+        if (next == NIL_BUCKET || lfu->buckets[next].frequency != frequency) {
+            next = lfuCreateBucket(lfu, frequency, bucket);
+        }
+        lfuUnlinkFrame(lfu, frame);
+        lfuLinkFrame(lfu, next, frame);
+        return true;
+    }
+
+    // Si la lista de frames ya está llena, reemplazar la página LFU
+    if (lfu->numFrames == lfu->capacity) {
+        *victim = lfuEvict(lfu);
+    }
+
+    // Crear un nuevo frame para la nueva página con frecuencia 1
+    uint32_t newFrame = createFrame(lfu->frames);
+    frameAt(lfu->frames, newFrame)->page = page;
+    frameAt(lfu->frames, newFrame)->valid = true;
+    uint32_t first = lfu->firstBucket;
+    if (first == NIL_BUCKET || lfu->buckets[first].frequency != 1) {
+        first = lfuCreateBucket(lfu, 1, NIL_BUCKET);
+    }
+    lfuLinkFrame(lfu, first, newFrame);
+    indexInsert(lfu->index, page, newFrame);
+    lfu->numFrames++;
+    return false;
+}
+
+// Función para imprimir los frames de menor a mayor frecuencia (solo para fines de depuración)
+static inline void lfuPrint(void *state) {
+    LfuState *lfu = (LfuState *)state;
+    printf("Estado actual de la lista de frames:\n");
+    for (uint32_t bucket = lfu->firstBucket; bucket != NIL_BUCKET; bucket = lfu->buckets[bucket].next) {
+        for (uint32_t current = lfu->buckets[bucket].head; current != NIL_FRAME; current = frameAt(lfu->frames, current)->next) {
+            Frame *f = frameAt(lfu->frames, current);
+            printf("Página: %lld, ", (long long)f->page);
+            printf("Estado: %s, ", f->valid ? "Ocupado" : "Vacío");
+            printf("Frecuencia: %d\n", f->frequency);
+        }
+    }
+    printf("\n");
+}
+
+// Función para liberar el estado de la política LFU
+static inline void lfuDestroy(void *state) {
+    LfuState *lfu = (LfuState *)state;
+    destroyFrameList(lfu->frames);
+    free(lfu->buckets);
+    free(lfu->bucketOf);
+    destroyPageIndex(lfu->index);
+    free(lfu);
+}
+
+static const PolicyOps lfuPolicy = {
+    "lfu", "LFU (menos frecuentemente usada)", false,
+    lfuInit, lfuAccess, lfuEvict, lfuRemove, lfuPrint, lfuDestroy
+};
+
+#endif
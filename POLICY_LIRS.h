@@ -0,0 +1,249 @@
+#ifndef POLICY_LIRS_H
+#define POLICY_LIRS_H
+
+#include "POLICY.h"
+#include "PAGE_INDEX.h"
+
+// LIRS (Low Inter-reference Recency Set, Jiang y Zhang): en lugar de la recencia usa la distancia
+// entre los dos últimos usos de cada página. Las páginas con distancia corta (LIR) ocupan casi toda
+// la memoria y solo se expulsan páginas HIR residentes, que viven en una cola FIFO pequeña Q
+// (1% de los frames). La pila S ordena por recencia a las páginas LIR y a las HIR (residentes o ya
+// expulsadas, los "fantasmas") cuyo último uso es más reciente que el de la LIR más antigua; una
+// HIR que se vuelve a pedir mientras está en S tiene una distancia menor que esa LIR, así que toma
+// su lugar. Tras cada cambio se poda S para que su fondo sea siempre una página LIR.
+// Cada entrada tiene dos pares de enlaces: los de S (en 'stackPool') y los de Q o de la cola de
+// fantasmas (en 'queuePool', un arreglo paralelo con el mismo índice); los fantasmas se limitan a
+// LIRS_GHOST_FACTOR * capacity y se olvidan del más antiguo al más nuevo. Todo es O(1).
+// head = más reciente (tope de S), tail = más antiguo (fondo de S, siguiente en salir de Q).
+
+#define LIRS_HIR_PERCENT 1    // Porcentaje de frames reservados a las páginas HIR residentes
+#define LIRS_GHOST_FACTOR 2   // Fantasmas como máximo por cada frame
+
+enum LirsStatus { LIRS_LIR, LIRS_HIR, LIRS_GHOST };
+
+// Estado de la política LIRS
+typedef struct LirsState {
+    FrameList *stackPool;       // Entradas con su página y los enlaces de S
+    FrameList *queuePool;       // Enlaces de Q y de la cola de fantasmas (mismo índice que stackPool)
+    FrameList stack;            // Pila S (vista sobre stackPool)
+    FrameList queue;            // Cola Q de HIR residentes (vista sobre queuePool)
+    FrameList ghosts;           // Fantasmas en orden de expulsión (vista sobre queuePool)
+    uint8_t *status;            // LIRS_LIR, LIRS_HIR o LIRS_GHOST de cada entrada
+    bool *inStack;              // Indica si la entrada está en S
+    PageIndex *index;           // Índice página -> entrada
+    int numLir;                 // Número de páginas LIR
+    int lirLimit;               // Número máximo de páginas LIR
+    int ghostLimit;             // Número máximo de fantasmas
+    int capacity;               // Número máximo de frames residentes
+} LirsState;
+
+// Función para liberar el estado de la política LIRS
+static inline void lirsDestroy(void *state) {
+    LirsState *lirs = (LirsState *)state;
+    destroyFrameList(lirs->stackPool);
+    destroyFrameList(lirs->queuePool);
+    destroyPageIndex(lirs->index);
+    free(lirs->status);
+    free(lirs->inStack);
+    free(lirs);
+}
+
+// Función para crear el estado de la política LIRS
+static inline void* lirsInit(int capacity) {
+    LirsState *lirs = (LirsState *)calloc(1, sizeof(LirsState));
+    if (lirs == NULL) {
+        return NULL;
+    }
+    // Al menos un frame para HIR y uno para LIR (con un solo frame LIRS se comporta como LRU)
+    int hirLimit = capacity * LIRS_HIR_PERCENT / 100 > 0 ? capacity * LIRS_HIR_PERCENT / 100 : 1;
+    lirs->lirLimit = capacity - hirLimit > 0 ? capacity - hirLimit : 1;
+    lirs->ghostLimit = LIRS_GHOST_FACTOR * capacity;
+    lirs->capacity = capacity;
+    int entries = capacity + lirs->ghostLimit;
+    lirs->stackPool = createFrameList(entries);
+    lirs->queuePool = createFrameList(entries);
+    lirs->status = (uint8_t *)malloc((size_t)entries * sizeof(uint8_t));
+    lirs->inStack = (bool *)calloc((size_t)entries, sizeof(bool));
+    lirs->index = createPageIndex((uint64_t)entries);
+    if (lirs->stackPool == NULL || lirs->queuePool == NULL || lirs->status == NULL || lirs->inStack == NULL ||
+        lirs->index == NULL) {
+        lirsDestroy(lirs);
+        return NULL;
+    }
+    initFrameListView(&lirs->stack, lirs->stackPool);
+    initFrameListView(&lirs->queue, lirs->queuePool);
+    initFrameListView(&lirs->ghosts, lirs->queuePool);
+    return lirs;
+}
+
+// Función para obtener la página de una entrada
+static inline PageId lirsPage(LirsState *lirs, uint32_t entry) {
+    return frameAt(lirs->stackPool, entry)->page;
+}
+
+// Función para poner una entrada en el tope de S
+static inline void lirsPushStack(LirsState *lirs, uint32_t entry) {
+    if (lirs->inStack[entry]) {
+        unlinkFrame(&lirs->stack, entry);
+    }
+    insertFrame(&lirs->stack, entry);
+    lirs->inStack[entry] = true;
+}
+
+// Función para olvidar por completo una entrada (ya fuera de S y de las colas)
+static inline void lirsForget(LirsState *lirs, uint32_t entry) {
+    indexRemove(lirs->index, lirsPage(lirs, entry));
+    freeFrame(lirs->stackPool, entry);
+}
+
+// Función para podar S: quita las entradas HIR del fondo hasta que quede una LIR
+// (las HIR residentes siguen en Q y los fantasmas se olvidan)
+static inline void lirsPrune(LirsState *lirs) {
+    while (lirs->stack.tail != NIL_FRAME && lirs->status[lirs->stack.tail] != LIRS_LIR) {
+        uint32_t entry = lirs->stack.tail;
+        unlinkFrame(&lirs->stack, entry);
+        lirs->inStack[entry] = false;
+        if (lirs->status[entry] == LIRS_GHOST) {
+            unlinkFrame(&lirs->ghosts, entry);
+            lirsForget(lirs, entry);
+        }
+    }
+}
+
+// Función para convertir en LIR una entrada que ya está en el tope de S; si hay demasiadas LIR,
+// la del fondo de S pasa a ser HIR residente al final de Q
+static inline void lirsPromote(LirsState *lirs, uint32_t entry) {
+    lirs->status[entry] = LIRS_LIR;
+    if (++lirs->numLir > lirs->lirLimit) {
+        uint32_t bottom = lirs->stack.tail;
+        unlinkFrame(&lirs->stack, bottom);
+        lirs->inStack[bottom] = false;
+        lirs->status[bottom] = LIRS_HIR;
+        appendFrame(&lirs->queue, bottom);
+        lirs->numLir--;
+        lirsPrune(lirs);
+    }
+}
+
+// Función para expulsar de memoria el primer HIR residente de Q (o, si Q está vacía, la LIR del
+// fondo de S); si sigue en S queda como fantasma
+static inline PageId lirsReplace(LirsState *lirs) {
+    uint32_t entry = lirs->queue.head;
+    if (entry == NIL_FRAME) {
+        entry = lirs->stack.tail;
+        unlinkFrame(&lirs->stack, entry);
+        lirs->inStack[entry] = false;
+        lirs->numLir--;
+        lirsPrune(lirs);
+    } else {
+        unlinkFrame(&lirs->queue, entry);
+    }
+    PageId page = lirsPage(lirs, entry);
+    if (!lirs->inStack[entry]) {
+        lirsForget(lirs, entry);
+        return page;
+    }
+    lirs->status[entry] = LIRS_GHOST;
+    frameAt(lirs->stackPool, entry)->valid = false;
+    appendFrame(&lirs->ghosts, entry);
+    if (lirs->ghosts.numFrames > lirs->ghostLimit) {
+        uint32_t oldest = lirs->ghosts.head;
+        unlinkFrame(&lirs->ghosts, oldest);
+        unlinkFrame(&lirs->stack, oldest); // Nunca es el fondo de S, que siempre es LIR
+        lirs->inStack[oldest] = false;
+        lirsForget(lirs, oldest);
+    }
+    return page;
+}
+
+// Función para expulsar una página elegida por LIRS
+static inline PageId lirsEvict(void *state) {
+    LirsState *lirs = (LirsState *)state;
+    if (lirs->numLir + lirs->queue.numFrames == 0) {
+        return NO_PAGE;
+    }
+    return lirsReplace(lirs);
+}
+
+// Función para simular la carga de una página a memoria física utilizando LIRS
+static inline bool lirsAccess(void *state, PageId page, uint64_t nextUse, PageId *victim) {
+    LirsState *lirs = (LirsState *)state;
+    (void)nextUse;
+    uint64_t *value = indexFind(lirs->index, page);
+    if (value != NULL) {
+        uint32_t entry = (uint32_t)*value;
+        if (lirs->status[entry] == LIRS_LIR) {
+            bool bottom = entry == lirs->stack.tail;
+            lirsPushStack(lirs, entry);
+            if (bottom) {
+                lirsPrune(lirs);
+            }
+            return true;
+        }
+        if (lirs->status[entry] == LIRS_HIR) {
+            unlinkFrame(&lirs->queue, entry);
+            if (lirs->inStack[entry]) {
+                lirsPushStack(lirs, entry);
+                lirsPromote(lirs, entry);
+            } else {
+                lirsPushStack(lirs, entry);
+                appendFrame(&lirs->queue, entry);
+            }
+            return true;
+        }
+    }
+
+    // Fallo: liberar un frame y volver a buscar, porque el fantasma de la página pudo olvidarse
+    if (lirs->numLir + lirs->queue.numFrames == lirs->capacity) {
+        *victim = lirsReplace(lirs);
+        value = indexFind(lirs->index, page);
+    }
+    if (value != NULL) {
+        // Fantasma en S: su distancia entre usos es menor que la de la LIR más antigua
+        uint32_t entry = (uint32_t)*value;
+        unlinkFrame(&lirs->ghosts, entry);
+        frameAt(lirs->stackPool, entry)->valid = true;
+        lirsPushStack(lirs, entry);
+        lirsPromote(lirs, entry);
+        return false;
+    }
+
+    uint32_t entry = createFrame(lirs->stackPool);
+    frameAt(lirs->stackPool, entry)->page = page;
+    frameAt(lirs->stackPool, entry)->valid = true;
+    lirs->inStack[entry] = false;
+    indexInsert(lirs->index, page, entry);
+    lirsPushStack(lirs, entry);
+    if (lirs->numLir < lirs->lirLimit) {
+        lirs->status[entry] = LIRS_LIR; // Mientras haya lugar, toda página nueva es LIR
+        lirs->numLir++;
+    } else {
+        lirs->status[entry] = LIRS_HIR;
+        appendFrame(&lirs->queue, entry);
+    }
+    return false;
+}
+
+// Función para imprimir la pila S y la cola Q de LIRS (solo para fines de depuración)
+static inline void lirsPrint(void *state) {
+    LirsState *lirs = (LirsState *)state;
+    static const char *const tags[] = {"L", "H", "f"};
+    printf("Estado actual de LIRS (LIR %d/%d, HIR residentes %d, fantasmas %d):\n",
+           lirs->numLir, lirs->lirLimit, lirs->queue.numFrames, lirs->ghosts.numFrames);
+    printf("S:");
+    for (uint32_t current = lirs->stack.head; current != NIL_FRAME; current = frameAt(lirs->stackPool, current)->next) {
+        printf(" %lld%s", (long long)lirsPage(lirs, current), tags[lirs->status[current]]);
+    }
+    printf("\nQ:");
+    for (uint32_t current = lirs->queue.head; current != NIL_FRAME; current = frameAt(lirs->queuePool, current)->next) {
+        printf(" %lld", (long long)lirsPage(lirs, current));
+    }
+    printf("\n\n");
+}
+
+static const PolicyOps lirsPolicy = {
+    "lirs", "LIRS (distancia entre usos)", false,
+    lirsInit, lirsAccess, lirsEvict, NULL, lirsPrint, lirsDestroy
+};
+
+#endif
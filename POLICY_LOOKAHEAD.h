@@ -0,0 +1,329 @@
+#ifndef POLICY_LOOKAHEAD_H
+#define POLICY_LOOKAHEAD_H
+
+#include "POLICY.h"
+#include "PAGE_INDEX.h"
+
+// OPT con ventana acotada: en lugar de todo el futuro (como POLICY_OPT.h y OPR.C) solo se conocen
+// las próximas W referencias, así que la política puede simular una entrada que llega como flujo.
+// Las páginas cargadas cuyo próximo uso cae dentro de la ventana están en un montículo de máximos
+// por próximo uso (Belady dentro de la ventana); las demás vuelven más tarde que todas ellas, pero
+// no se sabe en qué orden, así que forman una lista LRU y se expulsan primero, de la menos
+// recientemente usada a la más. Con W = 0 es LRU y con W mayor que la traza tiene los aciertos de OPT.
+// La política no ve la ventana: la administra LookaheadWindow (abajo), que guarda las W referencias
+// en un anillo y le avisa con lookaheadReveal cuando el próximo uso de una página cargada entra
+// a la ventana.
+
+// Estado de la política con ventana
+typedef struct LookaheadState {
+    FrameList *pool;        // Arreglo de frames
+    FrameList beyond;       // Páginas que no vuelven dentro de la ventana (head = más reciente)
+    uint32_t *heap;         // Montículo de máximos por próximo uso de las páginas que vuelven
+    uint32_t *heapPos;      // Posición de cada frame en el montículo (NIL_FRAME si está en 'beyond')
+    uint64_t *nextUse;      // Próximo uso de la página de cada frame del montículo
+    int heapSize;           // Frames en el montículo
+    PageIndex *index;       // Índice página -> frame
+    int numFrames;          // Número de frames ocupados
+    int capacity;           // Número máximo de frames
+} LookaheadState;
+
+// Función para crear el estado de la política con ventana
+static inline void* lookaheadInit(int capacity) {
+    LookaheadState *lookahead = (LookaheadState *)calloc(1, sizeof(LookaheadState));
+    if (lookahead == NULL) {
+        return NULL;
+    }
+    lookahead->pool = createFrameList(capacity);
+    lookahead->heap = (uint32_t *)malloc((size_t)capacity * sizeof(uint32_t));
+    lookahead->heapPos = (uint32_t *)malloc((size_t)capacity * sizeof(uint32_t));
+    lookahead->nextUse = (uint64_t *)malloc((size_t)capacity * sizeof(uint64_t));
+    lookahead->index = createPageIndex(capacity);
+    lookahead->capacity = capacity;
+    if (lookahead->pool == NULL || lookahead->heap == NULL || lookahead->heapPos == NULL || lookahead->nextUse == NULL ||
+        lookahead->index == NULL) {
+        destroyFrameList(lookahead->pool);
+        free(lookahead->heap);
+        free(lookahead->heapPos);
+        free(lookahead->nextUse);
+        destroyPageIndex(lookahead->index);
+        free(lookahead);
+        return NULL;
+    }
+    initFrameListView(&lookahead->beyond, lookahead->pool);
+    return lookahead;
+}
+
+// Función para intercambiar dos posiciones del montículo
+static inline void lookaheadSwap(LookaheadState *lookahead, int a, int b) {
+    uint32_t tmp = lookahead->heap[a];
+    lookahead->heap[a] = lookahead->heap[b];
+    lookahead->heap[b] = tmp;
+    lookahead->heapPos[lookahead->heap[a]] = (uint32_t)a;
+    lookahead->heapPos[lookahead->heap[b]] = (uint32_t)b;
+}
+
+// Función para subir un frame en el montículo mientras su próximo uso sea más lejano que el de su padre
+static inline void lookaheadSiftUp(LookaheadState *lookahead, int pos) {
+    while (pos > 0) {
+        int parent = (pos - 1) / 2;
+        if (lookahead->nextUse[lookahead->heap[parent]] >= lookahead->nextUse[lookahead->heap[pos]]) {
+            break;
+        }
+        lookaheadSwap(lookahead, pos, parent);
+        pos = parent;
+    }
+}
+
+// Función para bajar un frame en el montículo mientras algún hijo se use más tarde
+static inline void lookaheadSiftDown(LookaheadState *lookahead, int pos) {
+    for (;;) {
+        int largest = pos;
+        int left = 2 * pos + 1;
+        int right = left + 1;
+        if (left < lookahead->heapSize && lookahead->nextUse[lookahead->heap[left]] > lookahead->nextUse[lookahead->heap[largest]]) {
+            largest = left;
+        }
+        if (right < lookahead->heapSize && lookahead->nextUse[lookahead->heap[right]] > lookahead->nextUse[lookahead->heap[largest]]) {
+            largest = right;
+        }
+        if (largest == pos) {
+            break;
+        }
+        lookaheadSwap(lookahead, pos, largest);
+        pos = largest;
+    }
+}
+
+// Función para agregar un frame al montículo (próximo uso conocido) o al frente de la lista LRU
+static inline void lookaheadPlace(LookaheadState *lookahead, uint32_t frame, uint64_t nextUse) {
+    if (nextUse == NEVER) {
+        lookahead->heapPos[frame] = NIL_FRAME;
+        insertFrame(&lookahead->beyond, frame);
+        return;
+    }
+    int pos = lookahead->heapSize++;
+    lookahead->nextUse[frame] = nextUse;
+    lookahead->heap[pos] = frame;
+    lookahead->heapPos[frame] = (uint32_t)pos;
+    lookaheadSiftUp(lookahead, pos);
+}
+
+// Función para sacar un frame del montículo o de la lista LRU
+static inline void lookaheadDetach(LookaheadState *lookahead, uint32_t frame) {
+    if (lookahead->heapPos[frame] == NIL_FRAME) {
+        unlinkFrame(&lookahead->beyond, frame);
+        return;
+    }
+    int pos = (int)lookahead->heapPos[frame];
+    int last = --lookahead->heapSize;
+    if (pos != last) {
+        lookaheadSwap(lookahead, pos, last);
+        lookaheadSiftDown(lookahead, pos);
+        lookaheadSiftUp(lookahead, pos);
+    }
+}
+
+// Función para liberar el frame de una página cargada
+static inline void lookaheadDrop(LookaheadState *lookahead, uint32_t frame) {
+    lookaheadDetach(lookahead, frame);
+    indexRemove(lookahead->index, frameAt(lookahead->pool, frame)->page);
+    freeFrame(lookahead->pool, frame);
+    lookahead->numFrames--;
+}
+
+// Función para expulsar la página LRU de las que no vuelven dentro de la ventana o, si todas
+// vuelven, la que vuelve más tarde
+static inline PageId lookaheadEvict(void *state) {
+    LookaheadState *lookahead = (LookaheadState *)state;
+    if (lookahead->numFrames == 0) {
+        return NO_PAGE;
+    }
+    uint32_t frame = lookahead->beyond.tail != NIL_FRAME ? lookahead->beyond.tail : lookahead->heap[0];
+    PageId page = frameAt(lookahead->pool, frame)->page;
+    lookaheadDrop(lookahead, frame);
+    return page;
+}
+
+// Función para quitar una página cargada
+static inline bool lookaheadRemove(void *state, PageId page) {
+    LookaheadState *lookahead = (LookaheadState *)state;
+    uint64_t *value = indexFind(lookahead->index, page);
+    if (value == NULL) {
+        return false;
+    }
+    lookaheadDrop(lookahead, (uint32_t)*value);
+    return true;
+}
+
+// Función para avisar que el próximo uso de una página (si está cargada) entró a la ventana
+// en la posición 'position'
+static inline void lookaheadReveal(void *state, PageId page, uint64_t position) {
+    LookaheadState *lookahead = (LookaheadState *)state;
+    uint64_t *value = indexFind(lookahead->index, page);
+    if (value != NULL && lookahead->heapPos[*value] == NIL_FRAME) {
+        unlinkFrame(&lookahead->beyond, (uint32_t)*value);
+        lookaheadPlace(lookahead, (uint32_t)*value, position);
+    }
+}
+
+// Función para simular la carga de una página a memoria física con la ventana; 'nextUse' es la
+// posición de su próximo uso si está dentro de la ventana y NEVER si no
+static inline bool lookaheadAccess(void *state, PageId page, uint64_t nextUse, PageId *victim) {
+    LookaheadState *lookahead = (LookaheadState *)state;
+    uint64_t *value = indexFind(lookahead->index, page);
+    if (value != NULL) {
+        uint32_t frame = (uint32_t)*value;
+        if (lookahead->heapPos[frame] != NIL_FRAME && nextUse != NEVER) {
+            // Su próximo uso solo puede alejarse
+            lookahead->nextUse[frame] = nextUse;
+            lookaheadSiftUp(lookahead, (int)lookahead->heapPos[frame]);
+        } else {
+            lookaheadDetach(lookahead, frame);
+            lookaheadPlace(lookahead, frame, nextUse);
+        }
+        return true;
+    }
+
+    if (lookahead->numFrames == lookahead->capacity) {
+        *victim = lookaheadEvict(lookahead);
+    }
+    uint32_t frame = createFrame(lookahead->pool);
+    frameAt(lookahead->pool, frame)->page = page;
+    frameAt(lookahead->pool, frame)->valid = true;
+    lookahead->numFrames++;
+    lookaheadPlace(lookahead, frame, nextUse);
+    indexInsert(lookahead->index, page, frame);
+    return false;
+}
+
+// Función para imprimir las páginas que vuelven dentro de la ventana y las demás (solo para
+// fines de depuración)
+static inline void lookaheadPrint(void *state) {
+    LookaheadState *lookahead = (LookaheadState *)state;
+    printf("Estado actual de OPT con ventana:\n");
+    for (int pos = 0; pos < lookahead->heapSize; ++pos) {
+        uint32_t frame = lookahead->heap[pos];
+        printf("Página: %lld, Próximo uso: %llu\n", (long long)frameAt(lookahead->pool, frame)->page,
+               (unsigned long long)lookahead->nextUse[frame]);
+    }
+    for (uint32_t current = lookahead->beyond.head; current != NIL_FRAME; current = frameAt(lookahead->pool, current)->next) {
+        printf("Página: %lld, Próximo uso: fuera de la ventana\n", (long long)frameAt(lookahead->pool, current)->page);
+    }
+    printf("\n");
+}
+
+// Función para liberar el estado de la política con ventana
+static inline void lookaheadDestroy(void *state) {
+    LookaheadState *lookahead = (LookaheadState *)state;
+    destroyFrameList(lookahead->pool);
+    free(lookahead->heap);
+    free(lookahead->heapPos);
+    free(lookahead->nextUse);
+    destroyPageIndex(lookahead->index);
+    free(lookahead);
+}
+
+static const PolicyOps lookaheadPolicy = {
+    "lookahead", "OPT con ventana (Belady en la ventana, LRU fuera)", false,
+    lookaheadInit, lookaheadAccess, lookaheadEvict, lookaheadRemove, lookaheadPrint, lookaheadDestroy
+};
+
+#define LOOKAHEAD_MAX_WINDOW (1ULL << 28)   // Referencias como máximo en la ventana
+
+// Referencia guardada en la ventana
+typedef struct LookaheadEntry {
+    PageId page;            // Página referenciada
+    uint64_t nextUse;       // Posición de su próximo uso dentro de la ventana (NEVER si no hay)
+} LookaheadEntry;
+
+// Ventana de las próximas W referencias de un flujo sobre la política con ventana. Cada referencia
+// que entra completa el próximo uso de la aparición anterior de su página si sigue en la ventana
+// (índice 'lastSeen', que solo guarda páginas de la ventana) y, si no, se lo avisa a la política.
+// Una referencia se simula cuando ya entraron las W siguientes.
+typedef struct LookaheadWindow {
+    Policy *policy;         // Política con ventana
+    LookaheadEntry *ring;   // Anillo de referencias (potencia de dos mayor que W)
+    uint64_t mask;          // Tamaño del anillo - 1
+    uint64_t window;        // W: referencias conocidas después de la que se simula
+    uint64_t entered;       // Referencias que entraron a la ventana
+    uint64_t processed;     // Referencias ya simuladas
+    PageIndex *lastSeen;    // Índice página -> posición de su última aparición en la ventana
+} LookaheadWindow;
+
+// Función para liberar una ventana y su política
+static inline void destroyLookaheadWindow(LookaheadWindow *window) {
+    if (window != NULL) {
+        destroyPolicy(window->policy);
+        free(window->ring);
+        destroyPageIndex(window->lastSeen);
+        free(window);
+    }
+}
+
+// Función para crear una ventana de 'size' referencias sobre la política con 'capacity' frames
+static inline LookaheadWindow* createLookaheadWindow(int capacity, uint64_t size) {
+    if (size > LOOKAHEAD_MAX_WINDOW) {
+        return NULL;
+    }
+    LookaheadWindow *window = (LookaheadWindow *)calloc(1, sizeof(LookaheadWindow));
+    if (window == NULL) {
+        return NULL;
+    }
+    uint64_t slots = 1;
+    while (slots <= size) {
+        slots <<= 1;
+    }
+    window->mask = slots - 1;
+    window->window = size;
+    window->policy = createPolicy(&lookaheadPolicy, capacity);
+    window->ring = (LookaheadEntry *)malloc(slots * sizeof(LookaheadEntry));
+    window->lastSeen = createPageIndex(slots < 1024 ? slots : 1024);
+    if (window->policy == NULL || window->ring == NULL || window->lastSeen == NULL) {
+        destroyLookaheadWindow(window);
+        return NULL;
+    }
+    return window;
+}
+
+// Función para simular la referencia más antigua de la ventana
+static inline void lookaheadProcess(LookaheadWindow *window) {
+    uint64_t position = window->processed++;
+    LookaheadEntry *entry = &window->ring[position & window->mask];
+    uint64_t *seen = indexFind(window->lastSeen, entry->page);
+    if (seen != NULL && *seen == position) {
+        indexRemove(window->lastSeen, entry->page); // No vuelve dentro de la ventana
+    }
+    policyAccess(window->policy, entry->page, entry->nextUse, NULL);
+}
+
+// Función para agregar la siguiente referencia del flujo; simula la que queda W posiciones atrás.
+// Devuelve false si no hay memoria para el índice de la ventana
+static inline bool lookaheadPush(LookaheadWindow *window, PageId page) {
+    uint64_t position = window->entered++;
+    LookaheadEntry *entry = &window->ring[position & window->mask];
+    entry->page = page;
+    entry->nextUse = NEVER;
+    uint64_t *seen = indexFind(window->lastSeen, page);
+    if (seen != NULL) {
+        window->ring[*seen & window->mask].nextUse = position;
+        *seen = position;
+    } else {
+        lookaheadReveal(window->policy->state, page, position);
+        if (!indexInsert(window->lastSeen, page, position)) {
+            return false;
+        }
+    }
+    if (window->entered - window->processed > window->window) {
+        lookaheadProcess(window);
+    }
+    return true;
+}
+
+// Función para simular las referencias que quedan en la ventana al terminar el flujo
+static inline void lookaheadFinish(LookaheadWindow *window) {
+    while (window->processed < window->entered) {
+        lookaheadProcess(window);
+    }
+}
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef POLICY_LRU_H
+#define POLICY_LRU_H
+
+#include "POLICY.h"
+#include "PAGE_INDEX.h"
+
+// Estado de la política LRU: lista ordenada por recencia más un índice página -> frame
+typedef struct LruState {
+    FrameList *frames;  // Frames ordenados por uso (head = más recientemente usado)
+    PageIndex *index;   // Índice página -> frame para encontrar un frame en O(1)
+    int capacity;       // Número máximo de frames
+} LruState;
+
+// Función para crear el estado de la política LRU
+static inline void* lruInit(int capacity) {
+    LruState *lru = (LruState *)malloc(sizeof(LruState));
+    if (lru == NULL) {
+        return NULL;
+    }
+    lru->frames = createFrameList(capacity);
+    lru->index = createPageIndex(capacity);
+    lru->capacity = capacity;
+    if (lru->frames == NULL || lru->index == NULL) {
+        destroyFrameList(lru->frames);
+        destroyPageIndex(lru->index);
+        free(lru);
+        return NULL;
+    }
+    return lru;
+}
+
+// Función para expulsar el frame menos recientemente usado (tail)
+static inline PageId lruEvict(void *state) {
+    LruState *lru = (LruState *)state;
+    uint32_t lruFrame = lru->frames->tail;
+    if (lruFrame == NIL_FRAME) {
+        return NO_PAGE;
+    }
+    PageId page = frameAt(lru->frames, lruFrame)->page;
+    indexRemove(lru->index, page);
+    removeFrame(lru->frames, lruFrame);
+    return page;
+}
+
+// Función para quitar una página cargada
+static inline bool lruRemove(void *state, PageId page) {
+    LruState *lru = (LruState *)state;
+    uint64_t *value = indexFind(lru->index, page);
+    if (value == NULL) {
+        return false;
+    }
+    uint32_t frame = (uint32_t)*value;
+    indexRemove(lru->index, page);
+    removeFrame(lru->frames, frame);
+    return true;
+}
+
+// Función para simular la carga de una página a memoria física utilizando LRU
+static inline bool lruAccess(void *state, PageId page, uint64_t nextUse, PageId *victim) {
+    LruState *lru = (LruState *)state;
+    (void)nextUse;
+    uint64_t *value = indexFind(lru->index, page);
+    if (value != NULL) {
+        // Página ya está en memoria, moverla al frente (más recientemente usada)
+        moveToFront(lru->frames, (uint32_t)*value);
+        return true;
+    }
+
+    // Si la lista de frames ya está llena, eliminar el frame menos recientemente usado
+    if (lru->frames->numFrames == lru->capacity) {
+        *victim = lruEvict(lru);
+    }
+
+    // Insertar el nuevo frame al frente y registrarlo en el índice
+    uint32_t frame = createFrame(lru->frames);
+    frameAt(lru->frames, frame)->page = page;
+    frameAt(lru->frames, frame)->valid = true;
+    insertFrame(lru->frames, frame);
+    indexInsert(lru->index, page, frame);
+    return false;
+}
+
+// Función para imprimir los frames de la política LRU
+static inline void lruPrint(void *state) {
+    printFrameList(((LruState *)state)->frames);
+}
+
+// Función para liberar el estado de la política LRU
+static inline void lruDestroy(void *state) {
+    LruState *lru = (LruState *)state;
+    destroyFrameList(lru->frames);
+    destroyPageIndex(lru->index);
+    free(lru);
+}
+
+static const PolicyOps lruPolicy = {
+    "lru", "LRU (menos recientemente usada)", false,
+    lruInit, lruAccess, lruEvict, lruRemove, lruPrint, lruDestroy
+};
+
+#endif
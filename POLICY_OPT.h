@@ -0,0 +1,208 @@
+#ifndef POLICY_OPT_H
+#define POLICY_OPT_H
+
+#include "POLICY.h"
+#include "PAGE_INDEX.h"
+
+#define NEVER32 UINT32_MAX   // Valor de NEVER en los arreglos compactos de próximo uso
+
+// Estado de la política óptima (Belady): montículo de máximos ordenado por próximo uso
+typedef struct OptState {
+    FrameList *frames;  // Frames en memoria (el más reciente al frente)
+    uint32_t *heap;     // Montículo de máximos por próximo uso (la raíz es la víctima óptima)
+    uint32_t *heapPos;  // Posición de cada frame dentro del montículo
+    uint64_t *nextUse;  // Posición del próximo acceso a la página de cada frame
+    PageIndex *index;   // Índice página -> frame para detectar aciertos en O(1)
+    int capacity;       // Número máximo de frames
+} OptState;
+
+// Función para calcular, con una sola pasada hacia atrás, la posición del próximo acceso
+// a la misma página para cada referencia de la traza (NEVER32 si no vuelve a aparecer)
+static inline bool computeNextUse(const PageId *trace, uint32_t count, uint32_t *nextUse) {
+    PageIndex *lastSeen = createPageIndex(1024);
+    if (lastSeen == NULL) {
+        return false;
+    }
+    for (uint32_t i = count; i-- > 0;) {
+        uint64_t *seen = indexFind(lastSeen, trace[i]);
+        if (seen != NULL) {
+            nextUse[i] = (uint32_t)*seen;
+            *seen = i;
+        } else {
+            nextUse[i] = NEVER32;
+            if (!indexInsert(lastSeen, trace[i], i)) {
+                destroyPageIndex(lastSeen);
+                return false;
+            }
+        }
+    }
+    destroyPageIndex(lastSeen);
+    return true;
+}
+
+// Función para crear el estado de la política óptima
+static inline void* optInit(int capacity) {
+    OptState *opt = (OptState *)malloc(sizeof(OptState));
+    if (opt == NULL) {
+        return NULL;
+    }
+    opt->frames = createFrameList(capacity);
+    opt->heap = (uint32_t *)malloc((size_t)capacity * sizeof(uint32_t));
+    opt->heapPos = (uint32_t *)malloc((size_t)capacity * sizeof(uint32_t));
+    opt->nextUse = (uint64_t *)malloc((size_t)capacity * sizeof(uint64_t));
+    opt->index = createPageIndex(capacity);
+    opt->capacity = capacity;
+    if (opt->frames == NULL || opt->heap == NULL || opt->heapPos == NULL || opt->nextUse == NULL || opt->index == NULL) {
+        destroyFrameList(opt->frames);
+        free(opt->heap);
+        free(opt->heapPos);
+        free(opt->nextUse);
+        destroyPageIndex(opt->index);
+        free(opt);
+        return NULL;
+    }
+    return opt;
+}
+
+// Función para obtener el próximo uso del frame que está en una posición del montículo
+static inline uint64_t optKey(OptState *opt, int pos) {
+    return opt->nextUse[opt->heap[pos]];
+}
+
+// Función para intercambiar dos posiciones del montículo
+static inline void optSwap(OptState *opt, int a, int b) {
+    uint32_t tmp = opt->heap[a];
+    opt->heap[a] = opt->heap[b];
+    opt->heap[b] = tmp;
+    opt->heapPos[opt->heap[a]] = a;
+    opt->heapPos[opt->heap[b]] = b;
+}
+
+// Función para subir un frame en el montículo mientras su próximo uso sea más lejano que el de su padre
+static inline void optSiftUp(OptState *opt, int pos) {
+    while (pos > 0) {
+        int parent = (pos - 1) / 2;
+        if (optKey(opt, parent) >= optKey(opt, pos)) {
+            break;
+        }
+        optSwap(opt, pos, parent);
+        pos = parent;
+    }
+}
+
+// Función para bajar un frame en el montículo mientras algún hijo se use más tarde
+static inline void optSiftDown(OptState *opt, int pos) {
+    int size = opt->frames->numFrames;
+    for (;;) {
+        int largest = pos;
+        int left = 2 * pos + 1;
+        int right = left + 1;
+        if (left < size && optKey(opt, left) > optKey(opt, largest)) {
+            largest = left;
+        }
+        if (right < size && optKey(opt, right) > optKey(opt, largest)) {
+            largest = right;
+        }
+        if (largest == pos) {
+            break;
+        }
+        optSwap(opt, pos, largest);
+        pos = largest;
+    }
+}
+
+// Función para expulsar la página que se usará más tarde (raíz del montículo)
+static inline PageId optEvict(void *state) {
+    OptState *opt = (OptState *)state;
+    if (opt->frames->numFrames == 0) {
+        return NO_PAGE;
+    }
+
+    uint32_t victim = opt->heap[0];
+    PageId page = frameAt(opt->frames, victim)->page;
+    int last = opt->frames->numFrames - 1;
+    if (last > 0) {
+        optSwap(opt, 0, last);
+    }
+    indexRemove(opt->index, page);
+    removeFrame(opt->frames, victim);
+    optSiftDown(opt, 0);
+    return page;
+}
+
+// Función para quitar una página cargada: el último elemento del montículo ocupa su lugar
+static inline bool optRemove(void *state, PageId page) {
+    OptState *opt = (OptState *)state;
+    uint64_t *value = indexFind(opt->index, page);
+    if (value == NULL) {
+        return false;
+    }
+    uint32_t frame = (uint32_t)*value;
+    int pos = (int)opt->heapPos[frame];
+    int last = opt->frames->numFrames - 1;
+    if (pos != last) {
+        optSwap(opt, pos, last);
+    }
+    indexRemove(opt->index, page);
+    removeFrame(opt->frames, frame);
+    if (pos < opt->frames->numFrames) {
+        optSiftDown(opt, pos);
+        optSiftUp(opt, pos);
+    }
+    return true;
+}
+
+// Función para simular la carga de una página a memoria física utilizando The Optimal Page Replacement Algorithm
+// 'nextUse' es la posición del próximo acceso a esta página (calculada con computeNextUse)
+static inline bool optAccess(void *state, PageId page, uint64_t nextUse, PageId *victim) {
+    OptState *opt = (OptState *)state;
+    uint64_t *value = indexFind(opt->index, page);
+    if (value != NULL) {
+        // La página ya está en memoria: su próximo uso solo puede alejarse
+        uint32_t frame = (uint32_t)*value;
+        opt->nextUse[frame] = nextUse;
+        optSiftUp(opt, (int)opt->heapPos[frame]);
+        return true;
+    }
+
+    // Si la lista de frames ya está llena, reemplazar la página que se usará más tarde
+    if (opt->frames->numFrames == opt->capacity) {
+        *victim = optEvict(opt);
+    }
+
+    // Insertar el nuevo frame en la lista, el montículo y el índice
+    uint32_t frame = createFrame(opt->frames);
+    frameAt(opt->frames, frame)->page = page;
+    frameAt(opt->frames, frame)->valid = true;
+    int pos = opt->frames->numFrames;
+    opt->nextUse[frame] = nextUse;
+    opt->heap[pos] = frame;
+    opt->heapPos[frame] = (uint32_t)pos;
+    insertFrame(opt->frames, frame);
+    optSiftUp(opt, pos);
+    indexInsert(opt->index, page, frame);
+    return false;
+}
+
+// Función para imprimir los frames de la política óptima
+static inline void optPrint(void *state) {
+    printFrameList(((OptState *)state)->frames);
+}
+
+// Función para liberar el estado de la política óptima
+static inline void optDestroy(void *state) {
+    OptState *opt = (OptState *)state;
+    destroyFrameList(opt->frames);
+    free(opt->heap);
+    free(opt->heapPos);
+    free(opt->nextUse);
+    destroyPageIndex(opt->index);
+    free(opt);
+}
+
+static const PolicyOps optPolicy = {
+    "opt", "OPT (óptimo de Belady)", true,
+    optInit, optAccess, optEvict, optRemove, optPrint, optDestroy
+};
+
+#endif
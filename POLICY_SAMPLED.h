@@ -0,0 +1,212 @@
+#ifndef POLICY_SAMPLED_H
+#define POLICY_SAMPLED_H
+
+#include "POLICY.h"
+#include "PAGE_INDEX.h"
+
+// LRU aproximado por muestreo (como el de Redis): en lugar de una lista ordenada cada ranura
+// guarda solo una marca de tiempo de 32 bits en un arreglo plano, y un acierto solo la actualiza.
+// Para expulsar se eligen 'samples' ranuras al azar y sale la de marca más antigua. Con una reserva
+// de candidatos (pool) los mejores candidatos de muestreos anteriores se conservan ordenados por
+// antigüedad, lo que acerca el resultado al LRU exacto con el mismo número de muestras; un
+// candidato se descarta si su página se volvió a usar (cambió su marca) o ya no está en su ranura.
+// Las marcas son el número de acceso módulo 2^32 y la antigüedad se calcula con resta sin signo.
+// Las páginas ocupan las ranuras 0..numFrames-1 sin huecos para que el muestreo sea uniforme.
+
+#define SAMPLED_LRU_SAMPLES 5      // Muestras por expulsión por defecto
+#define SAMPLED_LRU_POOL 16        // Tamaño de la reserva de candidatos por defecto
+#define SAMPLED_LRU_MAX_POOL 64    // Tamaño máximo de la reserva de candidatos
+
+// Candidato a expulsión guardado en la reserva
+typedef struct SampledCandidate {
+    PageId page;            // Página candidata
+    uint32_t slot;          // Ranura donde estaba al muestrearla
+    uint32_t stamp;         // Marca de tiempo al muestrearla
+} SampledCandidate;
+
+// Estado de la política LRU aproximada
+typedef struct SampledLruState {
+    PageId *pages;          // Página de cada ranura
+    uint32_t *stamps;       // Marca de tiempo del último uso de cada ranura
+    PageIndex *index;       // Índice página -> ranura
+    int numFrames;          // Número de ranuras ocupadas
+    int capacity;           // Número máximo de frames
+    uint32_t clock;         // Número de accesos (módulo 2^32)
+    uint64_t random;        // Estado del generador pseudoaleatorio
+    int samples;            // Muestras por expulsión
+    int poolSize;           // Tamaño de la reserva (0 = sin reserva)
+    int poolCount;          // Candidatos en la reserva (ordenados del más nuevo al más antiguo)
+    SampledCandidate pool[SAMPLED_LRU_MAX_POOL];
+} SampledLruState;
+
+// Función para crear el estado de la política LRU aproximada
+static inline void* sampledLruInit(int capacity) {
+    SampledLruState *sampled = (SampledLruState *)calloc(1, sizeof(SampledLruState));
+    if (sampled == NULL) {
+        return NULL;
+    }
+    sampled->pages = (PageId *)malloc((size_t)capacity * sizeof(PageId));
+    sampled->stamps = (uint32_t *)malloc((size_t)capacity * sizeof(uint32_t));
+    sampled->index = createPageIndex((uint64_t)capacity);
+    if (sampled->pages == NULL || sampled->stamps == NULL || sampled->index == NULL) {
+        free(sampled->pages);
+        free(sampled->stamps);
+        destroyPageIndex(sampled->index);
+        free(sampled);
+        return NULL;
+    }
+    sampled->capacity = capacity;
+    sampled->random = 0x9E3779B97F4A7C15ULL;
+    sampled->samples = SAMPLED_LRU_SAMPLES;
+    sampled->poolSize = SAMPLED_LRU_POOL;
+    return sampled;
+}
+
+// Función para cambiar el número de muestras y el tamaño de la reserva (0 = sin reserva)
+static inline void sampledLruConfigure(void *state, int samples, int poolSize) {
+    SampledLruState *sampled = (SampledLruState *)state;
+    sampled->samples = samples > 0 ? samples : 1;
+    sampled->poolSize = poolSize < 0 ? 0 : poolSize > SAMPLED_LRU_MAX_POOL ? SAMPLED_LRU_MAX_POOL : poolSize;
+    sampled->poolCount = 0;
+}
+
+// Función para elegir una ranura ocupada al azar (xorshift64* y multiplicación y desplazamiento)
+static inline uint32_t sampledLruRandomSlot(SampledLruState *sampled) {
+    uint64_t r = nextRandom(&sampled->random) >> 32;
+    return (uint32_t)((r * (uint64_t)sampled->numFrames) >> 32);
+}
+
+// Función para agregar un candidato a la reserva manteniéndola ordenada por antigüedad; si está
+// llena el candidato reemplaza al más nuevo, siempre que sea más antiguo que él
+static inline void sampledLruOffer(SampledLruState *sampled, uint32_t slot, int limit) {
+    uint32_t age = sampled->clock - sampled->stamps[slot];
+    PageId page = sampled->pages[slot];
+    int pos = 0;
+    while (pos < sampled->poolCount && sampled->clock - sampled->pool[pos].stamp < age) {
+        pos++;
+    }
+    if (pos < sampled->poolCount && sampled->pool[pos].page == page) {
+        return; // Ya está en la reserva
+    }
+    if (sampled->poolCount == limit) {
+        if (pos == 0) {
+            return; // Más nuevo que todos los candidatos
+        }
+        memmove(&sampled->pool[0], &sampled->pool[1], (size_t)(pos - 1) * sizeof(SampledCandidate));
+        pos--;
+    } else {
+        memmove(&sampled->pool[pos + 1], &sampled->pool[pos], (size_t)(sampled->poolCount - pos) * sizeof(SampledCandidate));
+        sampled->poolCount++;
+    }
+    sampled->pool[pos].page = page;
+    sampled->pool[pos].slot = slot;
+    sampled->pool[pos].stamp = sampled->stamps[slot];
+}
+
+// Función para elegir la ranura a expulsar: muestrea 'samples' ranuras hacia la reserva y toma el
+// candidato más antiguo que siga siendo válido
+static inline uint32_t sampledLruChooseSlot(SampledLruState *sampled) {
+    int limit = sampled->poolSize > 0 ? sampled->poolSize : 1;
+    for (;;) {
+        if (sampled->poolSize == 0) {
+            sampled->poolCount = 0; // Sin reserva: solo cuentan las muestras de esta expulsión
+        }
+        for (int i = 0; i < sampled->samples; ++i) {
+            sampledLruOffer(sampled, sampledLruRandomSlot(sampled), limit);
+        }
+        while (sampled->poolCount > 0) {
+            SampledCandidate *best = &sampled->pool[--sampled->poolCount];
+            if (best->slot < (uint32_t)sampled->numFrames && sampled->pages[best->slot] == best->page &&
+                sampled->stamps[best->slot] == best->stamp) {
+                return best->slot;
+            }
+        }
+    }
+}
+
+// Función para vaciar una ranura ocupada; devuelve la página que tenía
+static inline PageId sampledLruClearSlot(SampledLruState *sampled, uint32_t slot) {
+    PageId page = sampled->pages[slot];
+    indexRemove(sampled->index, page);
+
+    // Mover la última ranura al hueco para que las ocupadas sigan siendo 0..numFrames-1
+    uint32_t last = (uint32_t)--sampled->numFrames;
+    if (slot != last) {
+        sampled->pages[slot] = sampled->pages[last];
+        sampled->stamps[slot] = sampled->stamps[last];
+        *indexFind(sampled->index, sampled->pages[slot]) = slot;
+    }
+    return page;
+}
+
+// Función para expulsar una página elegida por muestreo
+static inline PageId sampledLruEvict(void *state) {
+    SampledLruState *sampled = (SampledLruState *)state;
+    if (sampled->numFrames == 0) {
+        return NO_PAGE;
+    }
+    return sampledLruClearSlot(sampled, sampledLruChooseSlot(sampled));
+}
+
+// Función para quitar una página cargada (los candidatos de la reserva que apunten a su ranura
+// se descartan solos porque la página ya no coincide)
+static inline bool sampledLruRemove(void *state, PageId page) {
+    SampledLruState *sampled = (SampledLruState *)state;
+    uint64_t *value = indexFind(sampled->index, page);
+    if (value == NULL) {
+        return false;
+    }
+    sampledLruClearSlot(sampled, (uint32_t)*value);
+    return true;
+}
+
+// Función para simular la carga de una página a memoria física con LRU aproximado
+static inline bool sampledLruAccess(void *state, PageId page, uint64_t nextUse, PageId *victim) {
+    SampledLruState *sampled = (SampledLruState *)state;
+    (void)nextUse;
+    uint32_t now = ++sampled->clock;
+    uint64_t *value = indexFind(sampled->index, page);
+    if (value != NULL) {
+        sampled->stamps[*value] = now; // Un acierto solo actualiza la marca de tiempo
+        return true;
+    }
+
+    uint32_t slot;
+    if (sampled->numFrames < sampled->capacity) {
+        slot = (uint32_t)sampled->numFrames++;
+    } else {
+        slot = sampledLruChooseSlot(sampled);
+        *victim = sampled->pages[slot];
+        indexRemove(sampled->index, *victim);
+    }
+    sampled->pages[slot] = page;
+    sampled->stamps[slot] = now;
+    indexInsert(sampled->index, page, slot);
+    return false;
+}
+
+// Función para imprimir las páginas con su antigüedad (solo para fines de depuración)
+static inline void sampledLruPrint(void *state) {
+    SampledLruState *sampled = (SampledLruState *)state;
+    printf("Estado actual de LRU aproximado (%d muestras, reserva de %d):\n", sampled->samples, sampled->poolSize);
+    for (int slot = 0; slot < sampled->numFrames; ++slot) {
+        printf("Página: %lld, Antigüedad: %u\n", (long long)sampled->pages[slot], sampled->clock - sampled->stamps[slot]);
+    }
+    printf("\n");
+}
+
+// Función para liberar el estado de la política LRU aproximada
+static inline void sampledLruDestroy(void *state) {
+    SampledLruState *sampled = (SampledLruState *)state;
+    free(sampled->pages);
+    free(sampled->stamps);
+    destroyPageIndex(sampled->index);
+    free(sampled);
+}
+
+static const PolicyOps sampledLruPolicy = {
+    "sampled", "LRU aproximado (muestreo)", false,
+    sampledLruInit, sampledLruAccess, sampledLruEvict, sampledLruRemove, sampledLruPrint, sampledLruDestroy
+};
+
+#endif
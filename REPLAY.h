@@ -0,0 +1,209 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "POLICY.h"
+#include "POLICY_OPT.h"
+#include "TRACE.h"
+#include "EVENT_LOG.h"
+
+// Función para cargar una traza completa en memoria (necesario para las políticas que usan el futuro);
+// con 'writes' las referencias conservan la marca de escritura
+static inline PageId* loadTraceReferences(const char *path, uint32_t *count, bool writes) {
+    TraceReader *reader = openTrace(path);
+    if (reader == NULL) {
+        printf("No se pudo abrir la traza: %s\n", path);
+        return NULL;
+    }
+
+    size_t capacity = 1 << 16;
+    uint32_t loaded = 0;
+    PageId *trace = (PageId *)malloc(capacity * sizeof(PageId));
+    uint64_t page;
+    while (trace != NULL && (writes ? nextReference(reader, &page) : nextPage(reader, &page))) {
+        if (loaded == NEVER32) {
+            printf("La traza supera el máximo de %u referencias\n", NEVER32 - 1);
+            free(trace);
+            trace = NULL;
+            break;
+        }
+        if (loaded == capacity) {
+            capacity *= 2;
+            PageId *grown = (PageId *)realloc(trace, capacity * sizeof(PageId));
+            if (grown == NULL) {
+                printf("No hay memoria suficiente para cargar la traza\n");
+                free(trace);
+                trace = NULL;
+                break;
+            }
+            trace = grown;
+        }
+        trace[loaded++] = (PageId)page;
+    }
+    if (reader->corrupt) {
+        free(trace);
+        trace = NULL;
+    }
+    closeTrace(reader);
+
+    *count = loaded;
+    return trace;
+}
+
+// Función para cargar las páginas de una traza completa en memoria
+static inline PageId* loadTrace(const char *path, uint32_t *count) {
+    return loadTraceReferences(path, count, false);
+}
+
+// Función para calcular los próximos usos de una traza comprimida recorriendo sus bloques del
+// último al primero, sin cargar la traza en memoria (solo se guardan 4 bytes por acceso)
+static inline bool computeTraceNextUse(TraceReader *reader, uint32_t *nextUse) {
+    PageIndex *lastSeen = createPageIndex(1024);
+    if (lastSeen == NULL) {
+        printf("No hay memoria suficiente para calcular los próximos usos\n");
+        return false;
+    }
+    for (uint32_t block = reader->numBlocks; block-- > 0;) {
+        const uint64_t *pages;
+        uint32_t count = readTraceBlock(reader, block, reader->decoded, &pages);
+        uint64_t start = (uint64_t)block * reader->blockSize;
+        if (count == 0 || count != (block + 1 < reader->numBlocks ? reader->blockSize : reader->total - start)) {
+            printf("El bloque %u de la traza comprimida no es válido\n", block);
+            destroyPageIndex(lastSeen);
+            return false;
+        }
+        for (uint32_t i = count; i-- > 0;) {
+            uint32_t t = (uint32_t)(start + i);
+            uint64_t *seen = indexFind(lastSeen, referencePage(pages[i]));
+            if (seen != NULL) {
+                nextUse[t] = (uint32_t)*seen;
+                *seen = t;
+            } else {
+                nextUse[t] = NEVER32;
+                if (!indexInsert(lastSeen, referencePage(pages[i]), t)) {
+                    printf("No hay memoria suficiente para calcular los próximos usos\n");
+                    destroyPageIndex(lastSeen);
+                    return false;
+                }
+            }
+        }
+    }
+    destroyPageIndex(lastSeen);
+    return true;
+}
+
+// Función para simular el acceso número 'time' sobre todas las políticas (y registrarlo si hay registro de eventos)
+static inline void replayAccess(Policy **policies, int numPolicies, PageId page, uint64_t nextUse, uint64_t time, EventLog *events) {
+    if (events == NULL) {
+        for (int i = 0; i < numPolicies; ++i) {
+            policyAccess(policies[i], page, nextUse, NULL);
+        }
+        return;
+    }
+    for (int i = 0; i < numPolicies; ++i) {
+        PageId victim;
+        bool hit = policyAccess(policies[i], page, nextUse, &victim);
+        logEvent(events, time, (uint32_t)i, page, hit, victim);
+    }
+}
+
+// Función para simular una traza que ya está en memoria sobre varias políticas
+// (los próximos usos se calculan solo si alguna política los necesita)
+static inline bool replayPages(Policy **policies, int numPolicies, const PageId *trace, uint32_t count, EventLog *events) {
+    bool needsFuture = false;
+    for (int i = 0; i < numPolicies; ++i) {
+        needsFuture = needsFuture || policies[i]->ops->needsFuture;
+    }
+    uint32_t *nextUse = NULL;
+    if (needsFuture) {
+        nextUse = (uint32_t *)malloc(((size_t)count + 1) * sizeof(uint32_t));
+        if (nextUse == NULL || !computeNextUse(trace, count, nextUse)) {
+            printf("No hay memoria suficiente para calcular los próximos usos\n");
+            free(nextUse);
+            return false;
+        }
+    }
+    for (uint32_t t = 0; t < count; ++t) {
+        uint64_t next = nextUse == NULL || nextUse[t] == NEVER32 ? NEVER : nextUse[t];
+        replayAccess(policies, numPolicies, trace[t], next, t, events);
+    }
+    free(nextUse);
+    return true;
+}
+
+// Función para simular una traza sobre varias políticas a la vez, leyendo la entrada una sola vez
+// Si alguna política necesita el futuro (OPT) la traza se carga en memoria para calcular los próximos usos
+// Con 'events' distinto de NULL cada acceso de cada política se agrega al registro de eventos
+static inline bool replayTrace(Policy **policies, int numPolicies, const char *path, EventLog *events) {
+    bool needsFuture = false;
+    for (int i = 0; i < numPolicies; ++i) {
+        needsFuture = needsFuture || policies[i]->ops->needsFuture;
+    }
+
+    if (!needsFuture) {
+        TraceReader *reader = openTrace(path);
+        if (reader == NULL) {
+            printf("No se pudo abrir la traza: %s\n", path);
+            return false;
+        }
+        uint64_t page;
+        for (uint64_t time = 0; nextPage(reader, &page); ++time) {
+            replayAccess(policies, numPolicies, (PageId)page, NEVER, time, events);
+        }
+        bool ok = !reader->corrupt;
+        closeTrace(reader);
+        return ok;
+    }
+
+    // Una traza comprimida no se carga: los próximos usos se calculan hacia atrás por bloques y
+    // luego se vuelve a leer hacia adelante (la entrada estándar no se abre dos veces)
+    TraceReader *reader = strcmp(path, "-") != 0 ? openTrace(path) : NULL;
+    if (reader != NULL && reader->format == TRACE_BLOCKED) {
+        if (reader->total >= NEVER32) {
+            printf("La traza supera el máximo de %u referencias\n", NEVER32 - 1);
+            closeTrace(reader);
+            return false;
+        }
+        uint32_t *nextUse = (uint32_t *)malloc(((size_t)reader->total + 1) * sizeof(uint32_t));
+        bool ok = nextUse != NULL && computeTraceNextUse(reader, nextUse);
+        if (nextUse == NULL) {
+            printf("No hay memoria suficiente para calcular los próximos usos\n");
+        }
+        uint64_t page;
+        seekTraceBlock(reader, 0);
+        for (uint64_t time = 0; ok && nextPage(reader, &page); ++time) {
+            replayAccess(policies, numPolicies, (PageId)page, nextUse[time] == NEVER32 ? NEVER : nextUse[time], time, events);
+        }
+        free(nextUse);
+        closeTrace(reader);
+        return ok;
+    }
+    if (reader != NULL) {
+        closeTrace(reader);
+    }
+
+    uint32_t count;
+    PageId *trace = loadTrace(path, &count);
+    if (trace == NULL) {
+        return false;
+    }
+    bool ok = replayPages(policies, numPolicies, trace, count, events);
+    free(trace);
+    return ok;
+}
+
+// Función para simular una traza con una sola política e imprimir el resumen
+static inline int runTrace(const PolicyOps *ops, int capacity, const char *path) {
+    Policy *policy = createPolicy(ops, capacity);
+    if (policy == NULL) {
+        printf("No hay memoria suficiente para %d frames\n", capacity);
+        return 1;
+    }
+    bool ok = replayTrace(&policy, 1, path, NULL);
+    if (ok) {
+        printTraceSummary(policy->stats.accesses, policy->stats.hits);
+    }
+    destroyPolicy(policy);
+    return ok ? 0 : 1;
+}
+
+#endif
@@ -0,0 +1,319 @@
+#ifndef SHARDED_CACHE_H
+#define SHARDED_CACHE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "POLICY.h"
+#include "POLICY_CLOCK.h"
+#include "POLICY_LRU.h"
+#include "BENCH.h"
+
+// Caché de páginas para muchos hilos: el espacio de páginas se reparte por hash entre varios
+// shards y cada shard tiene su propia instancia de Clock o LRU protegida por un mutex.
+//
+// Los aciertos no toman el mutex: el índice página -> frame del shard se lee con cargas atómicas
+// y se valida con un seqlock (el contador 'seq' es impar mientras un hilo modifica el shard). Si
+// la lectura se cruzó con una modificación, el acceso se repite por el camino con lock.
+//  - Clock: el acierto enciende el bit de referencia de la ranura con un OR atómico.
+//  - LRU: el acierto se anota en un búfer circular del shard y la página se mueve al frente la
+//    próxima vez que alguien toma el lock (si el búfer está lleno el acierto se descarta, así que
+//    el orden es LRU aproximado). Cada ranura del búfer lleva un número de secuencia, como en la
+//    cola acotada de Vyukov: el hilo reserva la ranura avanzando readHead, escribe la página y
+//    recién entonces la publica; el vaciado se detiene en la primera ranura sin publicar (la toma
+//    el vaciado siguiente) y solo después de leerla la deja libre para la vuelta siguiente.
+// Los fallos toman el mutex del shard, aplican los aciertos pendientes y llaman a la política.
+// El índice de cada shard se dimensiona para que nunca se redimensione (los lectores sin lock
+// no pueden encontrarse con un arreglo liberado).
+// Requiere compilar con -pthread.
+
+#define SHARD_READ_BUFFER 64        // Aciertos de LRU pendientes por shard (potencia de dos)
+#define DEFAULT_SHARDS 64           // Número de shards por defecto
+#define CONTENTION_ACCESSES 2000000L // Accesos por hilo en la prueba de contención
+#define CONTENTION_MAX_THREADS 64   // Mayor número de hilos de la prueba de contención
+
+// Acierto de LRU anotado sin lock. La ranura de la posición p del búfer está libre para esa
+// posición si seq == p y publicada si seq == p + 1; al vaciarla pasa a p + SHARD_READ_BUFFER
+typedef struct ShardRead {
+    uint64_t seq;               // Número de secuencia de la ranura
+    PageId page;                // Página del acierto
+} ShardRead;
+
+// Shard de la caché (alineado para que dos shards no compartan línea de caché)
+typedef struct CacheShard {
+    uint64_t seq;               // Seqlock: impar mientras se modifica el shard
+    pthread_mutex_t lock;       // Protege la política en el camino de fallos
+    Policy *policy;             // Instancia de Clock o LRU del shard
+    PageIndex *index;           // Índice de la política (página -> ranura o frame; NULL en un Clock pequeño)
+    PageId *pages;              // Ranuras de un Clock pequeño, que se recorren en lugar del índice
+    int slots;                  // Número de ranuras a recorrer
+    uint64_t *referenced;       // Bits de referencia de Clock (NULL con LRU)
+    uint64_t readHead;          // Aciertos de LRU con ranura reservada en total
+    uint64_t readTail;          // Aciertos de LRU ya aplicados (solo con el lock)
+    ShardRead readBuffer[SHARD_READ_BUFFER]; // Aciertos de LRU sin aplicar
+} __attribute__((aligned(CACHE_LINE))) CacheShard;
+
+// Caché particionada
+typedef struct ShardedCache {
+    CacheShard *shards;         // Arreglo de shards
+    int numShards;              // Número de shards
+    const PolicyOps *ops;       // Política de cada shard (Clock o LRU)
+} ShardedCache;
+
+// Función para crear la caché con 'capacity' frames repartidos entre 'numShards' shards
+// Solo acepta Clock y LRU (las políticas con camino de aciertos sin lock)
+static inline ShardedCache* createShardedCache(const PolicyOps *ops, int capacity, int numShards) {
+    if ((ops != &clockPolicy && ops != &lruPolicy) || numShards < 1 || capacity < numShards) {
+        return NULL;
+    }
+    ShardedCache *cache = (ShardedCache *)malloc(sizeof(ShardedCache));
+    void *shards = NULL;
+    if (cache == NULL || posix_memalign(&shards, CACHE_LINE, (size_t)numShards * sizeof(CacheShard)) != 0) {
+        free(cache);
+        return NULL;
+    }
+    cache->shards = (CacheShard *)shards;
+    cache->numShards = numShards;
+    cache->ops = ops;
+    memset(cache->shards, 0, (size_t)numShards * sizeof(CacheShard));
+
+    for (int i = 0; i < numShards; ++i) {
+        CacheShard *shard = &cache->shards[i];
+        int shardCapacity = capacity / numShards + (i < capacity % numShards ? 1 : 0);
+        pthread_mutex_init(&shard->lock, NULL);
+        shard->policy = createPolicy(ops, shardCapacity);
+        if (shard->policy == NULL) {
+            for (int j = 0; j <= i; ++j) {
+                pthread_mutex_destroy(&cache->shards[j].lock);
+                destroyPolicy(cache->shards[j].policy);
+            }
+            free(cache->shards);
+            free(cache);
+            return NULL;
+        }
+        if (ops == &clockPolicy) {
+            ClockState *clockState = (ClockState *)shard->policy->state;
+            shard->index = clockState->index;
+            shard->pages = clockState->pages;
+            shard->slots = clockState->slots;
+            shard->referenced = clockState->referenced;
+        } else {
+            shard->index = ((LruState *)shard->policy->state)->index;
+            for (uint64_t r = 0; r < SHARD_READ_BUFFER; ++r) {
+                shard->readBuffer[r].seq = r;
+            }
+        }
+    }
+    return cache;
+}
+
+// Función para liberar la caché
+static inline void destroyShardedCache(ShardedCache *cache) {
+    if (cache != NULL) {
+        for (int i = 0; i < cache->numShards; ++i) {
+            pthread_mutex_destroy(&cache->shards[i].lock);
+            destroyPolicy(cache->shards[i].policy);
+        }
+        free(cache->shards);
+        free(cache);
+    }
+}
+
+// Función para elegir el shard de una página (bits altos del hash; el índice usa los bajos)
+static inline CacheShard* cacheShard(ShardedCache *cache, PageId page) {
+    uint64_t h = hashPage(page) >> 32;
+    return &cache->shards[(h * (uint64_t)cache->numShards) >> 32];
+}
+
+// Función para buscar una página en el índice de un shard sin tomar el lock
+// (puede fallar o devolver un valor viejo si se cruza con una escritura; se valida con el seqlock)
+static inline bool shardLookup(PageIndex *index, PageId page, uint64_t *value) {
+    IndexEntry *entries = index->entries;
+    uint64_t mask = index->mask;
+    uint64_t slot = hashPage(page) & mask;
+    for (uint64_t probes = 0; probes <= mask; ++probes) {
+        int64_t current = __atomic_load_n(&entries[slot].page, __ATOMIC_RELAXED);
+        if (current == page) {
+            *value = __atomic_load_n(&entries[slot].value, __ATOMIC_RELAXED);
+            return true;
+        }
+        if (current == EMPTY_PAGE) {
+            return false;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return false;
+}
+
+// Función para buscar una página en las ranuras de un Clock pequeño sin tomar el lock
+// (igual que shardLookup, el resultado se valida con el seqlock)
+static inline bool shardScan(const PageId *pages, int slots, PageId page, uint64_t *value) {
+    for (int i = 0; i < slots; ++i) {
+        if (__atomic_load_n(&pages[i], __ATOMIC_RELAXED) == page) {
+            *value = (uint64_t)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Función para intentar resolver un acierto sin lock; devuelve false si hay que tomar el lock
+static inline bool shardTryHit(CacheShard *shard, PageId page) {
+    uint64_t seq = __atomic_load_n(&shard->seq, __ATOMIC_ACQUIRE);
+    if (seq & 1) {
+        return false; // Otro hilo está modificando el shard
+    }
+    uint64_t value;
+    bool found = shard->index != NULL ? shardLookup(shard->index, page, &value)
+                                      : shardScan(shard->pages, shard->slots, page, &value);
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (!found || __atomic_load_n(&shard->seq, __ATOMIC_RELAXED) != seq) {
+        return false;
+    }
+
+    if (shard->referenced != NULL) {
+        // Clock: encender el bit de referencia (si un barrido lo apaga a la vez, solo se pierde precisión)
+        __atomic_fetch_or(&shard->referenced[value >> 6], 1ULL << (value & 63), __ATOMIC_RELAXED);
+    } else {
+        // LRU: anotar el acierto para aplicarlo con el lock (se descarta si la ranura de readHead
+        // todavía no se vació, es decir, si el búfer está lleno, o si otro hilo la reserva antes)
+        uint64_t head = __atomic_load_n(&shard->readHead, __ATOMIC_RELAXED);
+        ShardRead *read = &shard->readBuffer[head & (SHARD_READ_BUFFER - 1)];
+        if (__atomic_load_n(&read->seq, __ATOMIC_ACQUIRE) == head &&
+            __atomic_compare_exchange_n(&shard->readHead, &head, head + 1, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            __atomic_store_n(&read->page, page, __ATOMIC_RELAXED);
+            __atomic_store_n(&read->seq, head + 1, __ATOMIC_RELEASE);
+        }
+    }
+    return true;
+}
+
+// Función para aplicar los aciertos de LRU anotados sin lock (requiere el lock del shard); aplica
+// las ranuras publicadas en orden hasta la primera que no lo está, y como mucho una vuelta del
+// búfer para que los hilos que siguen anotando no retengan el lock
+static inline void shardDrainReads(CacheShard *shard) {
+    LruState *lru = (LruState *)shard->policy->state;
+    uint64_t tail = shard->readTail;
+    for (int n = 0; n < SHARD_READ_BUFFER; ++n, ++tail) {
+        ShardRead *read = &shard->readBuffer[tail & (SHARD_READ_BUFFER - 1)];
+        if (__atomic_load_n(&read->seq, __ATOMIC_ACQUIRE) != tail + 1) {
+            break; // Vacía o reservada por un hilo que todavía no escribió la página
+        }
+        PageId page = __atomic_load_n(&read->page, __ATOMIC_RELAXED);
+        __atomic_store_n(&read->seq, tail + SHARD_READ_BUFFER, __ATOMIC_RELEASE);
+        uint64_t *frame = indexFind(lru->index, page);
+        if (frame != NULL) {
+            moveToFront(lru->frames, (uint32_t)*frame); // La página pudo haber sido expulsada ya
+        }
+    }
+    shard->readTail = tail;
+}
+
+// Función para acceder a una página desde cualquier hilo; devuelve true si hubo acierto (una
+// página negativa está reservada y se rechaza como en policyAccess, antes de buscarla sin lock)
+static inline bool cacheAccess(ShardedCache *cache, PageId page) {
+    if (page < 0) {
+        return false;
+    }
+    CacheShard *shard = cacheShard(cache, page);
+    if (shardTryHit(shard, page)) {
+        return true;
+    }
+
+    pthread_mutex_lock(&shard->lock);
+    __atomic_store_n(&shard->seq, shard->seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    if (shard->referenced == NULL) {
+        shardDrainReads(shard);
+    }
+    bool hit = policyAccess(shard->policy, page, NEVER, NULL);
+    __atomic_store_n(&shard->seq, shard->seq + 1, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&shard->lock);
+    return hit;
+}
+
+// Argumentos y resultados de un hilo de la prueba de contención
+typedef struct ContentionThread {
+    ShardedCache *cache;        // Caché compartida
+    uint64_t universe;          // Número de páginas distintas
+    uint64_t seed;              // Semilla del generador del hilo
+    uint64_t hits;              // Aciertos del hilo
+    pthread_t thread;           // Hilo
+    char padding[CACHE_LINE];   // Evita compartir línea de caché con el hilo siguiente
+} ContentionThread;
+
+// Función que ejecuta cada hilo de la prueba de contención
+static void* contentionWorker(void *arg) {
+    ContentionThread *t = (ContentionThread *)arg;
+    uint64_t state = t->seed;
+    uint64_t hits = 0;
+    for (long i = 0; i < CONTENTION_ACCESSES; ++i) {
+        hits += cacheAccess(t->cache, randomPage(&state, t->universe));
+    }
+    t->hits = hits;
+    return NULL;
+}
+
+// Función para medir el rendimiento total de la caché con 1 a 64 hilos
+// Las páginas se eligen uniformemente entre pagesPerFrame * capacity páginas distintas
+static inline int runContentionBenchmark(const PolicyOps *ops, int capacity, int numShards, double pagesPerFrame) {
+    printf("%-10s %8d frames, %d shards\n", ops->name, capacity, numShards);
+    printf("%10s %16s %10s\n", "Hilos", "Accesos/s", "Aciertos");
+    ContentionThread *threads = (ContentionThread *)calloc(CONTENTION_MAX_THREADS, sizeof(ContentionThread));
+    if (threads == NULL) {
+        printf("No hay memoria suficiente para la prueba\n");
+        return 1;
+    }
+
+    for (int numThreads = 1; numThreads <= CONTENTION_MAX_THREADS; numThreads *= 2) {
+        ShardedCache *cache = createShardedCache(ops, capacity, numShards);
+        if (cache == NULL) {
+            printf("No se pudo crear la caché (%d frames, %d shards)\n", capacity, numShards);
+            free(threads);
+            return 1;
+        }
+        uint64_t universe = (uint64_t)(capacity * pagesPerFrame);
+
+        // Calentamiento: llenar la caché antes de medir
+        uint64_t state = 0x9E3779B97F4A7C15ULL;
+        for (uint64_t i = 0; i < universe; ++i) {
+            cacheAccess(cache, randomPage(&state, universe));
+        }
+
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        int started = 0;
+        for (; started < numThreads; ++started) {
+            threads[started].cache = cache;
+            threads[started].universe = universe;
+            threads[started].seed = 0x9E3779B97F4A7C15ULL * (uint64_t)(started + 1);
+            threads[started].hits = 0;
+            if (pthread_create(&threads[started].thread, NULL, contentionWorker, &threads[started]) != 0) {
+                break;
+            }
+        }
+        uint64_t hits = 0;
+        for (int i = 0; i < started; ++i) {
+            pthread_join(threads[i].thread, NULL);
+            hits += threads[i].hits;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        destroyShardedCache(cache);
+        if (started < numThreads) {
+            printf("Solo se pudieron crear %d de %d hilos\n", started, numThreads);
+            break;
+        }
+
+        double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+        double accesses = (double)CONTENTION_ACCESSES * numThreads;
+        printf("%10d %16.0f %9.2f%%\n", numThreads, accesses / seconds, 100.0 * hits / accesses);
+    }
+    free(threads);
+    return 0;
+}
+
+#endif
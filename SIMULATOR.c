@@ -0,0 +1,1525 @@
+// Simulador que reproduce una traza sobre varias políticas de reemplazo en una sola pasada
+// Uso: SIMULATOR [-f frames] [-p politicas] [-c] [-e eventos] traza
+//      SIMULATOR [-f frames] [-p politicas] [-c] [-e eventos] -w carga [-n accesos] [-s semilla]
+//      SIMULATOR --mrc [-f frames] traza
+//      SIMULATOR --sweep [-t hilos] [-f frames,frames,...] [-p politicas] traza
+//      SIMULATOR --scan-bench [-f frames] [-p politicas]
+//      SIMULATOR --concurrent [-f frames] [-p clock,lru] [--shards n]
+//      SIMULATOR --sampled [-f frames] [-k muestras] [--pool n] [traza]
+//      SIMULATOR --bench [-f frames] [-p politicas] [-n accesos] [-r repeticiones] [-o resultados] [--label etiqueta] [traza ...]
+//      SIMULATOR --processes modo [-f frames] [-p politica] (traza | -w carga [-n accesos] [-s semilla])
+//      SIMULATOR --vm [-f frames] [-p politicas] [--tlb tlb] [--levels n] [--latency latencias] (traza | -w carga ...)
+//      SIMULATOR --tiers niveles [--tier-mode modo] [--miss ns] (traza | -w carga ...)
+//      SIMULATOR --lookahead ventanas [-f frames] (traza | -w carga ...)
+//      SIMULATOR --convert salida [--format formato] traza
+//      SIMULATOR --generate carga [-n accesos] [-s semilla] [--format formato] salida
+//      SIMULATOR --verify [-n trazas] [-s semilla]
+// Compilar con -pthread -lm (los modos --sweep y --concurrent usan hilos y --scan-bench usa <math.h>)
+// Para que --bench cuente las reservas de memoria compilar un ejecutable aparte con
+// -DBENCH_COUNT_ALLOCATIONS y las opciones de enlace indicadas en BENCH.h
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <math.h>
+#include "MRC.h"
+#include "FRAME_ALLOCATION.h"
+#include "ORACLE.h"
+#include "POLICIES.h"
+#include "REPLAY.h"
+#include "SHARDED_CACHE.h"
+#include "SWEEP.h"
+#include "VM_MODEL.h"
+#include "CACHE_TIERS.h"
+#include "POLICY_LOOKAHEAD.h"
+#include "WORKLOAD.h"
+
+#define DEFAULT_FRAMES 4   // Número de frames si no se indica con -f
+#define TOP_FAULT_PAGES 10 // Páginas con más fallos que se muestran con -c
+#define CONCURRENT_FRAMES (1 << 16)   // Frames de la caché de --concurrent si no se indica con -f
+#define SCAN_BENCH_ACCESSES 2000000   // Longitud de las trazas de --scan-bench
+#define SAMPLED_FRAMES (1 << 16)      // Frames de --sampled si no se indica con -f
+#define WORKLOAD_ACCESSES 10000000    // Accesos de una carga generada si no se indica con -n
+#define WORKLOAD_CHUNK (1 << 16)      // Accesos que se generan de una vez
+#define BENCH_FRAMES 4096             // Frames de --bench si no se indica con -f
+#define BENCH_SUITE_ACCESSES (1 << 20) // Accesos de cada traza sintética de --bench si no se indica con -n
+#define BENCH_REPETITIONS 5           // Repeticiones medidas de --bench si no se indica con -r
+#define BENCH_WARMUP 1                // Pasadas sin medir antes de las repeticiones
+#define BENCH_MAX_TRACES 8            // Trazas grabadas que admite --bench
+#define VM_LEVELS 4                   // Niveles de la tabla de páginas de --vm si no se indica con --levels
+#define VM_TLB "16,4,lru"             // TLB de --vm si no se indica con --tlb (64 entradas)
+#define TIER_MISS_LATENCY 100000.0    // Latencia de un fallo de --tiers en ns si no se indica con --miss
+#define LOOKAHEAD_MAX_RUNS 16         // Ventanas que admite --lookahead
+
+// Formatos de salida de --convert (el primero es el formato por defecto)
+static const struct {
+    const char *name;
+    TraceFormat format;
+} traceFormats[] = {
+    {"comprimido", TRACE_BLOCKED}, {"bin64", TRACE_BINARY64}, {"bin32", TRACE_BINARY32}, {"texto", TRACE_TEXT}
+};
+
+// Función para imprimir la forma de uso del simulador
+void printUsage(const char *program) {
+    printf("Uso: %s [-f frames] [-p politicas] [-c] [-e eventos] traza\n", program);
+    printf("     %s [-f frames] [-p politicas] [-c] [-e eventos] -w carga [-n accesos] [-s semilla]\n", program);
+    printf("     %s --mrc [-f frames] traza\n", program);
+    printf("     %s --sweep [-t hilos] [-f frames,frames,...] [-p politicas] traza\n", program);
+    printf("     %s --scan-bench [-f frames] [-p politicas]\n", program);
+    printf("     %s --concurrent [-f frames] [-p clock,lru] [--shards n]\n", program);
+    printf("     %s --sampled [-f frames] [-k muestras] [--pool n] [traza]\n", program);
+    printf("     %s --bench [-f frames] [-p politicas] [-n accesos] [-r repeticiones] [-o resultados] [--label etiqueta] [traza ...]\n", program);
+    printf("     %s --processes modo [-f frames] [-p politica] (traza | -w carga [-n accesos] [-s semilla])\n", program);
+    printf("     %s --vm [-f frames] [-p politicas] [--tlb tlb] [--levels n] [--latency latencias] (traza | -w carga ...)\n", program);
+    printf("     %s --tiers niveles [--tier-mode modo] [--miss ns] (traza | -w carga ...)\n", program);
+    printf("     %s --lookahead ventanas [-f frames] (traza | -w carga ...)\n", program);
+    printf("     %s --convert salida [--format formato] traza\n", program);
+    printf("     %s --generate carga [-n accesos] [-s semilla] [--format formato] salida\n", program);
+    printf("     %s --verify [-n trazas] [-s semilla]\n", program);
+    printf("  -f frames     Número de frames de memoria física (por defecto %d)\n", DEFAULT_FRAMES);
+    printf("  -p politicas  Lista separada por comas (por defecto todas):");
+    for (int i = 0; i < NUM_POLICIES; ++i) {
+        printf(" %s", allPolicies[i]->name);
+    }
+    printf("\n  -c            Mostrar fallos obligatorios y de capacidad, expulsiones y las páginas con más fallos\n");
+    printf("  -e eventos    Escribir un registro binario con cada acceso (página, acierto, víctima)\n");
+    printf("  --mrc         Calcular la curva de tasa de fallos de LRU para todos los tamaños de\n");
+    printf("                memoria en una sola pasada (con -f, hasta ese número de frames)\n");
+    printf("  --sweep       Simular en paralelo cada combinación de política y número de frames,\n");
+    printf("                decodificando la traza una sola vez\n");
+    printf("  -t hilos      Hilos del barrido (por defecto uno por núcleo)\n");
+    printf("  --scan-bench  Comparar las políticas con trazas sintéticas: conjunto caliente con recorridos,\n");
+    printf("                ciclo, Zipf y una mezcla de los tres (con -f, solo ese número de frames)\n");
+    printf("  --concurrent  Medir la caché particionada (aciertos sin lock) con 1 a %d hilos\n", CONTENTION_MAX_THREADS);
+    printf("  --shards n    Shards de la caché particionada (por defecto %d)\n", DEFAULT_SHARDS);
+    printf("  --sampled     Comparar LRU aproximado por muestreo con LRU exacto: error en la tasa de\n");
+    printf("                aciertos, memoria y rendimiento (sin traza usa Zipf; por defecto %d frames)\n", SAMPLED_FRAMES);
+    printf("  -k muestras   Muestras por expulsión de --sampled (por defecto 1, 3, 5 y 10)\n");
+    printf("  --pool n      Reserva de candidatos de --sampled (por defecto 0 y %d)\n", SAMPLED_LRU_POOL);
+    printf("  --bench       Medir ns por acceso, tasa de aciertos, reservas por acceso y memoria pico de\n");
+    printf("                cada política con trazas sintéticas y grabadas (por defecto %d frames, %d accesos)\n",
+           BENCH_FRAMES, BENCH_SUITE_ACCESSES);
+    printf("  -r repeticiones  Repeticiones medidas de --bench después de %d de calentamiento (por defecto %d)\n",
+           BENCH_WARMUP, BENCH_REPETITIONS);
+    printf("  -o resultados Escribir los resultados de --bench en CSV (o en JSON si termina en .json)\n");
+    printf("  --label       Etiqueta de la versión medida en los resultados (por defecto \"local\")\n");
+    printf("  --processes   Repartir los frames entre los procesos de una traza etiquetada (\"proceso:página\"\n");
+    printf("                o fuentes con #proceso) y mostrar los fallos y el hambre de cada proceso; modo:\n");
+    printf("                global, local (partes iguales), ws:τ (conjunto de trabajo) o pff:T (frecuencia\n");
+    printf("                de fallos); política por defecto lru\n");
+    printf("  --vm          Simular lecturas y escrituras (\"página W\" en texto o '!' en -w) con TLB, tabla\n");
+    printf("                de páginas y escrituras de páginas sucias, y ordenar las políticas por el tiempo\n");
+    printf("                medio estimado por acceso\n");
+    printf("  --tlb tlb     Conjuntos (potencia de dos), vías y reemplazo (lru fifo random) del TLB de --vm\n");
+    printf("                (por defecto %s)\n", VM_TLB);
+    printf("  --levels n    Niveles de la tabla de páginas de --vm, de 1 a %d (por defecto %d)\n", VM_MAX_LEVELS, VM_LEVELS);
+    printf("  --latency l   Latencias de --vm en ns, por ejemplo \"tlb=1,mem=100,fault=100000,wb=100000\"\n");
+    printf("                (los valores por defecto)\n");
+    printf("  --tiers n     Simular una jerarquía de niveles \"política:frames@ns,...\" (del más rápido al más\n");
+    printf("                lento, por ejemplo \"lru:16k@100,clock:64k@2000,fifo:1M@20000\") y mostrar los\n");
+    printf("                aciertos de cada nivel y la latencia efectiva (ver CACHE_TIERS.h)\n");
+    printf("  --tier-mode   inclusive, exclusive o both (por defecto; las dos en la misma pasada)\n");
+    printf("  --miss ns     Latencia de un fallo en todos los niveles de --tiers (por defecto %.0f)\n", TIER_MISS_LATENCY);
+    printf("  --lookahead   Simular OPT con ventanas de W referencias (Belady dentro de la ventana y LRU\n");
+    printf("                fuera) y mostrar cuánto de la distancia entre LRU y OPT cierra cada ventana, por\n");
+    printf("                ejemplo \"0,256,4k,64k\" (admite k y M)\n");
+    printf("  -w carga      Simular una carga sintética en lugar de una traza, por ejemplo\n");
+    printf("                \"0.9*zipf:64k:0.99+0.1*scan\" o \"uniform:4k/1M;uniform:4k@4k/1M\" (ver WORKLOAD.h)\n");
+    printf("  -n accesos    Accesos de la carga (por defecto %d); como en las demás opciones, k y M son\n", WORKLOAD_ACCESSES);
+    printf("                binarios (×1024 y ×1048576): -n 200k son 204800 accesos, también en --bench\n");
+    printf("  -s semilla    Semilla de la carga y de --verify (por defecto 1)\n");
+    printf("  --generate    Escribir una carga sintética como traza e informar la velocidad de generación\n");
+    printf("  --convert     Escribir la traza en otro formato e informar el tamaño de cada archivo\n");
+    printf("  --format      Formato de --convert y --generate:");
+    for (size_t i = 0; i < sizeof(traceFormats) / sizeof(traceFormats[0]); ++i) {
+        printf(" %s", traceFormats[i].name);
+    }
+    printf(" (por defecto %s)\n", traceFormats[0].name);
+    printf("  --verify      Comparar cada política con su modelo de referencia usando trazas aleatorias\n");
+    printf("  traza         Archivo de traza en texto o binario (\"-\" para la entrada estándar)\n");
+}
+
+// Función para calcular e imprimir la curva de tasa de fallos de LRU de una traza
+int runMissRatioCurve(const char *path, int maxFrames) {
+    TraceReader *reader = openTrace(path);
+    if (reader == NULL) {
+        printf("No se pudo abrir la traza: %s\n", path);
+        return 1;
+    }
+    StackDistance *sd = createStackDistance();
+    bool ok = sd != NULL;
+    uint64_t page;
+    while (ok && nextPage(reader, &page)) {
+        ok = stackDistanceAccess(sd, (PageId)page);
+    }
+    bool corrupt = reader->corrupt;
+    closeTrace(reader);
+
+    if (corrupt) {
+        ok = false;
+    } else if (!ok) {
+        printf("No hay memoria suficiente para calcular la curva de fallos\n");
+    } else {
+        printMissRatioCurve(sd, (uint64_t)maxFrames);
+    }
+    destroyStackDistance(sd);
+    return ok ? 0 : 1;
+}
+
+// Función para obtener el tamaño de un archivo (0 si no es un archivo regular)
+uint64_t fileSize(const char *path) {
+    struct stat info;
+    return strcmp(path, "-") != 0 && stat(path, &info) == 0 && S_ISREG(info.st_mode) ? (uint64_t)info.st_size : 0;
+}
+
+// Función para escribir una traza en otro formato e informar cuánto ocupa cada versión
+int runTraceConversion(const char *path, const char *outPath, const char *formatName) {
+    size_t f = 0;
+    while (f < sizeof(traceFormats) / sizeof(traceFormats[0]) && strcmp(traceFormats[f].name, formatName) != 0) {
+        f++;
+    }
+    if (f == sizeof(traceFormats) / sizeof(traceFormats[0])) {
+        printf("Formato desconocido: %s\n", formatName);
+        return 1;
+    }
+    TraceReader *reader = openTrace(path);
+    if (reader == NULL) {
+        printf("No se pudo abrir la traza: %s\n", path);
+        return 1;
+    }
+    TraceWriter *writer = createTraceWriter(outPath, traceFormats[f].format);
+    if (writer == NULL) {
+        printf("No se pudo crear la traza: %s\n", outPath);
+        closeTrace(reader);
+        return 1;
+    }
+    uint64_t page;
+    uint64_t count = 0;
+    while (nextReference(reader, &page)) {
+        writePage(writer, page);
+        if (writer->failed) {
+            printf("La referencia %llu no cabe en el formato %s\n", (unsigned long long)count + 1, formatName);
+            break;
+        }
+        count++;
+    }
+    bool corrupt = reader->corrupt;
+    closeTrace(reader);
+    if (!closeTraceWriter(writer) || corrupt) {
+        printf("Error al escribir la traza: %s\n", outPath);
+        return 1;
+    }
+
+    uint64_t inBytes = fileSize(path);
+    uint64_t outBytes = fileSize(outPath);
+    printf("Referencias: %llu\n", (unsigned long long)count);
+    if (inBytes > 0) {
+        printf("Entrada: %llu bytes (%.2f bytes por referencia)\n", (unsigned long long)inBytes,
+               count > 0 ? (double)inBytes / count : 0.0);
+    }
+    if (outBytes > 0) {
+        printf("Salida (%s): %llu bytes (%.2f bytes por referencia)\n", traceFormats[f].name,
+               (unsigned long long)outBytes, count > 0 ? (double)outBytes / count : 0.0);
+    }
+    if (inBytes > 0 && outBytes > 0) {
+        printf("Relación entrada / salida: %.2f\n", (double)inBytes / outBytes);
+    }
+    return 0;
+}
+
+// Función para escribir una carga sintética como traza, midiendo por separado la generación
+int runWorkloadGeneration(const char *spec, uint64_t count, uint64_t seed, const char *outPath, const char *formatName) {
+    size_t f = 0;
+    while (f < sizeof(traceFormats) / sizeof(traceFormats[0]) && strcmp(traceFormats[f].name, formatName) != 0) {
+        f++;
+    }
+    if (f == sizeof(traceFormats) / sizeof(traceFormats[0])) {
+        printf("Formato desconocido: %s\n", formatName);
+        return 1;
+    }
+    Workload *workload = createWorkload(spec, seed);
+    if (workload == NULL) {
+        printf("Carga no válida o sin memoria suficiente: %s\n", spec);
+        return 1;
+    }
+    workload->keepWrites = true;
+    if (!traceFormatFits(traceFormats[f].format, workloadMaxReference(workload, count))) {
+        printf("La carga puede generar referencias que no caben en el formato %s: %s\n", formatName, spec);
+        destroyWorkload(workload);
+        return 1;
+    }
+    PageId *chunk = (PageId *)malloc(WORKLOAD_CHUNK * sizeof(PageId));
+    TraceWriter *writer = chunk != NULL ? createTraceWriter(outPath, traceFormats[f].format) : NULL;
+    if (writer == NULL) {
+        printf("No se pudo crear la traza: %s\n", outPath);
+        free(chunk);
+        destroyWorkload(workload);
+        return 1;
+    }
+
+    double generating = 0.0, writing = 0.0;
+    for (uint64_t done = 0; done < count;) {
+        uint64_t length = count - done < WORKLOAD_CHUNK ? count - done : WORKLOAD_CHUNK;
+        struct timespec start, middle, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        generateWorkload(workload, chunk, length);
+        clock_gettime(CLOCK_MONOTONIC, &middle);
+        for (uint64_t t = 0; t < length; ++t) {
+            writePage(writer, (uint64_t)chunk[t]);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        generating += (middle.tv_sec - start.tv_sec) + (middle.tv_nsec - start.tv_nsec) / 1e9;
+        writing += (end.tv_sec - middle.tv_sec) + (end.tv_nsec - middle.tv_nsec) / 1e9;
+        done += length;
+    }
+    free(chunk);
+    destroyWorkload(workload);
+    if (!closeTraceWriter(writer)) {
+        printf("Error al escribir la traza: %s\n", outPath);
+        return 1;
+    }
+    if (strcmp(outPath, "-") != 0) {
+        printf("Referencias: %llu (%s, semilla %llu)\n", (unsigned long long)count, spec, (unsigned long long)seed);
+        printf("Generación: %.3f s (%.0f millones de referencias/s)\n", generating,
+               generating > 0 ? count / generating / 1e6 : 0.0);
+        printf("Escritura (%s): %.3f s, %llu bytes\n", traceFormats[f].name, writing, (unsigned long long)fileSize(outPath));
+    }
+    return 0;
+}
+
+// Función para simular una carga sintética sobre varias políticas sin escribirla en un archivo
+// (si alguna política necesita el futuro se genera completa para calcular los próximos usos)
+bool replayWorkload(Policy **policies, int numPolicies, const char *spec, uint64_t count, uint64_t seed, EventLog *events) {
+    bool needsFuture = false;
+    for (int i = 0; i < numPolicies; ++i) {
+        needsFuture = needsFuture || policies[i]->ops->needsFuture;
+    }
+    if (needsFuture && count >= NEVER32) {
+        printf("La traza supera el máximo de %u referencias\n", NEVER32 - 1);
+        return false;
+    }
+    Workload *workload = createWorkload(spec, seed);
+    if (workload == NULL) {
+        printf("Carga no válida o sin memoria suficiente: %s\n", spec);
+        return false;
+    }
+    PageId *trace = (PageId *)malloc((needsFuture ? count : WORKLOAD_CHUNK) * sizeof(PageId));
+    bool ok = trace != NULL;
+    if (!ok) {
+        printf("No hay memoria suficiente para generar la carga\n");
+    } else if (needsFuture) {
+        generateWorkload(workload, trace, count);
+        ok = replayPages(policies, numPolicies, trace, (uint32_t)count, events);
+    } else {
+        for (uint64_t done = 0; done < count;) {
+            uint64_t length = count - done < WORKLOAD_CHUNK ? count - done : WORKLOAD_CHUNK;
+            generateWorkload(workload, trace, length);
+            for (uint64_t t = 0; t < length; ++t) {
+                replayAccess(policies, numPolicies, trace[t], NEVER, done + t, events);
+            }
+            done += length;
+        }
+    }
+    free(trace);
+    destroyWorkload(workload);
+    return ok;
+}
+
+// Función para repartir los frames entre los procesos de una traza etiquetada (o de una carga
+// sintética) según el modo de --processes; si la política necesita el futuro la traza se carga
+// completa para calcular los próximos usos
+int runFrameAllocation(const char *modeText, const char *name, int capacity, const char *path,
+                       const char *spec, uint64_t count, uint64_t seed) {
+    int mode;
+    uint64_t parameter;
+    if (!parseAllocationMode(modeText, &mode, &parameter)) {
+        printf("Modo de reparto no válido: %s (global, local, ws:τ o pff:T)\n", modeText);
+        return 1;
+    }
+    const PolicyOps *ops = findPolicy(name != NULL ? name : "lru");
+    if (ops == NULL) {
+        printf("Política desconocida: %s\n", name);
+        return 1;
+    }
+    FrameAllocator *allocator = createFrameAllocator(ops, capacity, mode, parameter);
+    if (allocator == NULL) {
+        printf("No hay memoria suficiente para %d frames\n", capacity);
+        return 1;
+    }
+
+    bool ok = true;
+    if (ops->needsFuture || spec != NULL) {
+        uint32_t length = 0;
+        PageId *trace = NULL;
+        uint32_t *nextUse = NULL;
+        if (spec != NULL) {
+            Workload *workload = count < NEVER32 ? createWorkload(spec, seed) : NULL;
+            trace = workload != NULL ? (PageId *)malloc(count * sizeof(PageId)) : NULL;
+            if (trace != NULL) {
+                generateWorkload(workload, trace, count);
+                length = (uint32_t)count;
+            } else {
+                printf("Carga no válida o sin memoria suficiente: %s\n", spec);
+            }
+            destroyWorkload(workload);
+        } else {
+            trace = loadTrace(path, &length);
+        }
+        if (trace != NULL && ops->needsFuture) {
+            nextUse = (uint32_t *)malloc(((size_t)length + 1) * sizeof(uint32_t));
+            if (nextUse == NULL || !computeNextUse(trace, length, nextUse)) {
+                printf("No hay memoria suficiente para calcular los próximos usos\n");
+                free(trace);
+                trace = NULL;
+            }
+        }
+        ok = trace != NULL;
+        for (uint32_t t = 0; ok && t < length; ++t) {
+            ok = allocatorAccess(allocator, trace[t], nextUse == NULL || nextUse[t] == NEVER32 ? NEVER : nextUse[t]);
+        }
+        free(trace);
+        free(nextUse);
+    } else {
+        TraceReader *reader = openTrace(path);
+        if (reader == NULL) {
+            printf("No se pudo abrir la traza: %s\n", path);
+            ok = false;
+        } else {
+            uint64_t page;
+            while (ok && nextPage(reader, &page)) {
+                ok = allocatorAccess(allocator, (PageId)page, NEVER);
+            }
+            ok = ok && !reader->corrupt;
+            closeTrace(reader);
+        }
+    }
+    if (ok) {
+        printAllocationStats(allocator);
+    }
+    destroyFrameAllocator(allocator);
+    return ok ? 0 : 1;
+}
+
+// Función para escribir en 'buffer' los nombres de todas las políticas separados por comas
+void listAllPolicies(char *buffer, size_t size) {
+    buffer[0] = '\0';
+    for (int i = 0; i < NUM_POLICIES; ++i) {
+        if (strlen(buffer) + strlen(allPolicies[i]->name) + 2 <= size) {
+            if (i > 0) {
+                strcat(buffer, ",");
+            }
+            strcat(buffer, allPolicies[i]->name);
+        }
+    }
+}
+
+// Función para simular en paralelo cada combinación de política y número de frames
+int runParallelSweep(const char *names, const char *framesList, int numWorkers, const char *path) {
+    // Contar las configuraciones: políticas x números de frames
+    int numFrames = 1;
+    for (const char *c = framesList; *c != '\0'; ++c) {
+        numFrames += *c == ',';
+    }
+    int numPolicies = 1;
+    for (const char *c = names; *c != '\0'; ++c) {
+        numPolicies += *c == ',';
+    }
+    SweepConfig *configs = (SweepConfig *)calloc((size_t)numFrames * numPolicies, sizeof(SweepConfig));
+    char *list = (char *)malloc(strlen(names) + strlen(framesList) + 2);
+    if (configs == NULL || list == NULL) {
+        printf("No hay memoria suficiente para el barrido\n");
+        free(configs);
+        free(list);
+        return 1;
+    }
+
+    int numConfigs = 0;
+    bool ok = true;
+    strcpy(list, names);
+    char *framesCopy = list + strlen(names) + 1;
+    strcpy(framesCopy, framesList);
+    for (char *name = strtok(list, ","); name != NULL && ok; name = strtok(NULL, ",")) {
+        const PolicyOps *ops = findPolicy(name);
+        if (ops == NULL) {
+            printf("Política desconocida: %s\n", name);
+            ok = false;
+            break;
+        }
+        for (const char *f = framesCopy; *f != '\0'; f = strchr(f, ',') != NULL ? strchr(f, ',') + 1 : "") {
+            int capacity;
+            if (!parseFrameCount(f, ',', &capacity)) {
+                printf("Número de frames no válido: %s\n", f);
+                ok = false;
+                break;
+            }
+            configs[numConfigs].ops = ops;
+            configs[numConfigs].capacity = capacity;
+            numConfigs++;
+        }
+    }
+    free(list);
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    ok = ok && runSweep(configs, numConfigs, numWorkers, path);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    if (ok) {
+        double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+        printStatsHeader();
+        for (int c = 0; c < numConfigs; ++c) {
+            printPolicyStats(configs[c].policy);
+        }
+        printf("Tiempo: %.3f s (%d configuraciones, %d hilos)\n", seconds, numConfigs,
+               numWorkers < numConfigs ? numWorkers : numConfigs);
+    }
+    for (int c = 0; c < numConfigs; ++c) {
+        destroyPolicy(configs[c].policy);
+    }
+    free(configs);
+    return ok ? 0 : 1;
+}
+
+// Función para medir la caché particionada con cada política de la lista (~94% de aciertos)
+int runConcurrentBenchmark(const char *names, int capacity, int numShards) {
+    char *list = (char *)malloc(strlen(names) + 1);
+    if (list == NULL) {
+        return 1;
+    }
+    strcpy(list, names);
+    int status = 0;
+    for (char *name = strtok(list, ","); name != NULL && status == 0; name = strtok(NULL, ",")) {
+        const PolicyOps *ops = findPolicy(name);
+        if (ops != &clockPolicy && ops != &lruPolicy) {
+            printf("La caché particionada solo admite clock y lru: %s\n", name);
+            status = 1;
+            break;
+        }
+        status = runContentionBenchmark(ops, capacity, numShards, 1.0625);
+        printf("\n");
+    }
+    free(list);
+    return status;
+}
+
+// Función para crear las políticas indicadas en una lista separada por comas; si falla alguna
+// libera las ya creadas y devuelve -1
+int createPolicies(const char *names, int capacity, Policy **policies) {
+    int count = 0;
+    char *list = (char *)malloc(strlen(names) + 1);
+    if (list == NULL) {
+        return -1;
+    }
+    strcpy(list, names);
+
+    bool ok = true;
+    for (char *name = strtok(list, ","); name != NULL; name = strtok(NULL, ",")) {
+        const PolicyOps *ops = findPolicy(name);
+        if (ops == NULL) {
+            printf("Política desconocida: %s\n", name);
+            ok = false;
+            break;
+        }
+        if (count == NUM_POLICIES) {
+            printf("Demasiadas políticas (máximo %d)\n", NUM_POLICIES);
+            ok = false;
+            break;
+        }
+        policies[count] = createPolicy(ops, capacity);
+        if (policies[count] == NULL) {
+            printf("No hay memoria suficiente para %d frames\n", capacity);
+            ok = false;
+            break;
+        }
+        count++;
+    }
+    free(list);
+    if (!ok) {
+        for (int i = 0; i < count; ++i) {
+            destroyPolicy(policies[i]);
+        }
+        return -1;
+    }
+    return count;
+}
+
+// Función para buscar las políticas indicadas en una lista separada por comas (todas si names es
+// NULL) sin crearlas; devuelve cuántas encontró o -1
+int findPolicyList(const char *names, const PolicyOps **ops) {
+    if (names == NULL) {
+        for (int i = 0; i < NUM_POLICIES; ++i) {
+            ops[i] = allPolicies[i];
+        }
+        return NUM_POLICIES;
+    }
+    char *list = (char *)malloc(strlen(names) + 1);
+    if (list == NULL) {
+        return -1;
+    }
+    strcpy(list, names);
+    int count = 0;
+    for (char *name = strtok(list, ","); name != NULL && count >= 0; name = strtok(NULL, ",")) {
+        if (count == NUM_POLICIES) {
+            printf("Demasiadas políticas (máximo %d)\n", NUM_POLICIES);
+            count = -1;
+        } else if ((ops[count] = findPolicy(name)) == NULL) {
+            printf("Política desconocida: %s\n", name);
+            count = -1;
+        } else {
+            count++;
+        }
+    }
+    free(list);
+    return count;
+}
+
+// Función para crear las políticas indicadas (todas si names es NULL); devuelve cuántas creó o -1
+int createPolicyList(const char *names, int capacity, Policy **policies) {
+    if (names != NULL) {
+        return createPolicies(names, capacity, policies);
+    }
+    for (int i = 0; i < NUM_POLICIES; ++i) {
+        policies[i] = createPolicy(allPolicies[i], capacity);
+        if (policies[i] == NULL) {
+            printf("No hay memoria suficiente para %d frames\n", capacity);
+            for (int j = 0; j < i; ++j) {
+                destroyPolicy(policies[j]);
+            }
+            return -1;
+        }
+    }
+    return NUM_POLICIES;
+}
+
+// Función para simular una traza (o una carga sintética) sobre una jerarquía de niveles inclusiva,
+// exclusiva o las dos a la vez, leyendo la entrada una sola vez
+int runTieredCache(const char *tierText, const char *modeText, double missLatency, const char *path, const char *spec,
+                   uint64_t count, uint64_t seed) {
+    TierSpec specs[MAX_TIERS];
+    int numTiers = parseTierSpec(tierText, specs);
+    if (numTiers == 0) {
+        printf("Niveles no válidos: %s (política:frames@ns,... con hasta %d niveles)\n", tierText, MAX_TIERS);
+        return 1;
+    }
+    bool modes[2];
+    modes[TIER_INCLUSIVE] = strcmp(modeText, "inclusive") == 0 || strcmp(modeText, "both") == 0;
+    modes[TIER_EXCLUSIVE] = strcmp(modeText, "exclusive") == 0 || strcmp(modeText, "both") == 0;
+    if (!modes[TIER_INCLUSIVE] && !modes[TIER_EXCLUSIVE]) {
+        printf("Modo de jerarquía no válido: %s (inclusive, exclusive o both)\n", modeText);
+        return 1;
+    }
+    if (missLatency < 0.0) {
+        printf("La latencia de fallo no puede ser negativa\n");
+        return 1;
+    }
+    bool needsFuture = false;
+    for (int i = 0; i < numTiers; ++i) {
+        if (specs[i].ops->remove == NULL) {
+            printf("La política %s no puede ser un nivel (no permite quitar páginas)\n", specs[i].ops->name);
+            return 1;
+        }
+        if (specs[i].ops->needsFuture && i > 0) {
+            printf("%s solo puede ser el primer nivel (ver CACHE_TIERS.h)\n", specs[i].ops->name);
+            return 1;
+        }
+        needsFuture = needsFuture || specs[i].ops->needsFuture;
+    }
+    TierHierarchy *hierarchies[2] = {NULL, NULL};
+    bool ok = true;
+    for (int mode = 0; mode < 2; ++mode) {
+        if (modes[mode] && ok) {
+            hierarchies[mode] = createTierHierarchy(specs, numTiers, mode, missLatency);
+            ok = hierarchies[mode] != NULL;
+        }
+    }
+    if (!ok) {
+        printf("No hay memoria suficiente para los niveles\n");
+    }
+
+    if (ok && (needsFuture || spec != NULL)) {
+        uint32_t length = 0;
+        PageId *trace = NULL;
+        uint32_t *nextUse = NULL;
+        if (spec != NULL) {
+            Workload *workload = count < NEVER32 ? createWorkload(spec, seed) : NULL;
+            trace = workload != NULL ? (PageId *)malloc(count * sizeof(PageId)) : NULL;
+            if (trace != NULL) {
+                generateWorkload(workload, trace, count);
+                length = (uint32_t)count;
+            } else {
+                printf("Carga no válida o sin memoria suficiente: %s\n", spec);
+            }
+            destroyWorkload(workload);
+        } else {
+            trace = loadTrace(path, &length);
+        }
+        if (trace != NULL && needsFuture) {
+            nextUse = (uint32_t *)malloc(((size_t)length + 1) * sizeof(uint32_t));
+            if (nextUse == NULL || !computeNextUse(trace, length, nextUse)) {
+                printf("No hay memoria suficiente para calcular los próximos usos\n");
+                free(trace);
+                trace = NULL;
+            }
+        }
+        ok = trace != NULL;
+        for (uint32_t t = 0; ok && t < length; ++t) {
+            uint64_t next = nextUse == NULL || nextUse[t] == NEVER32 ? NEVER : nextUse[t];
+            for (int mode = 0; mode < 2; ++mode) {
+                if (hierarchies[mode] != NULL) {
+                    tierAccess(hierarchies[mode], trace[t], next);
+                }
+            }
+        }
+        free(trace);
+        free(nextUse);
+    } else if (ok) {
+        TraceReader *reader = openTrace(path);
+        if (reader == NULL) {
+            printf("No se pudo abrir la traza: %s\n", path);
+            ok = false;
+        } else {
+            uint64_t page;
+            while (nextPage(reader, &page)) {
+                for (int mode = 0; mode < 2; ++mode) {
+                    if (hierarchies[mode] != NULL) {
+                        tierAccess(hierarchies[mode], (PageId)page, NEVER);
+                    }
+                }
+            }
+            ok = !reader->corrupt;
+            closeTrace(reader);
+        }
+    }
+
+    for (int mode = 0; mode < 2; ++mode) {
+        if (ok && hierarchies[mode] != NULL) {
+            printTierHierarchy(hierarchies[mode]);
+            printf("\n");
+        }
+        destroyTierHierarchy(hierarchies[mode]);
+    }
+    return ok ? 0 : 1;
+}
+
+// Función para comparar OPT con ventana para varias ventanas contra LRU y OPT en una sola pasada
+// (la traza se carga completa solo para calcular OPT; las ventanas la reciben como flujo)
+int runLookahead(const char *windowsText, int capacity, const char *path, const char *spec, uint64_t count, uint64_t seed) {
+    uint64_t sizes[LOOKAHEAD_MAX_RUNS];
+    int numWindows = 0;
+    const char *c = windowsText;
+    bool valid = true;
+    for (;;) {
+        valid = numWindows < LOOKAHEAD_MAX_RUNS && parseWorkloadCount(&c, &sizes[numWindows]) &&
+                sizes[numWindows] <= LOOKAHEAD_MAX_WINDOW && (*c == ',' || *c == '\0');
+        if (!valid) {
+            break;
+        }
+        numWindows++;
+        if (*c++ == '\0') {
+            break;
+        }
+    }
+    if (!valid) {
+        printf("Ventanas no válidas: %s (hasta %d tamaños separados por comas, cada uno hasta %llu)\n", windowsText,
+               LOOKAHEAD_MAX_RUNS, (unsigned long long)LOOKAHEAD_MAX_WINDOW);
+        return 1;
+    }
+
+    uint32_t length = 0;
+    PageId *trace = NULL;
+    if (spec != NULL) {
+        Workload *workload = count < NEVER32 ? createWorkload(spec, seed) : NULL;
+        trace = workload != NULL ? (PageId *)malloc(count * sizeof(PageId)) : NULL;
+        if (trace != NULL) {
+            generateWorkload(workload, trace, count);
+            length = (uint32_t)count;
+        } else {
+            printf("Carga no válida o sin memoria suficiente: %s\n", spec);
+        }
+        destroyWorkload(workload);
+    } else {
+        trace = loadTrace(path, &length);
+    }
+    if (trace == NULL) {
+        return 1;
+    }
+    uint32_t *nextUse = (uint32_t *)malloc(((size_t)length + 1) * sizeof(uint32_t));
+    Policy *lru = createPolicy(&lruPolicy, capacity);
+    Policy *opt = createPolicy(&optPolicy, capacity);
+    LookaheadWindow *windows[LOOKAHEAD_MAX_RUNS] = {NULL};
+    bool ok = nextUse != NULL && lru != NULL && opt != NULL && computeNextUse(trace, length, nextUse);
+    for (int i = 0; ok && i < numWindows; ++i) {
+        windows[i] = createLookaheadWindow(capacity, sizes[i]);
+        ok = windows[i] != NULL;
+    }
+    for (uint32_t t = 0; ok && t < length; ++t) {
+        policyAccess(lru, trace[t], NEVER, NULL);
+        policyAccess(opt, trace[t], nextUse[t] == NEVER32 ? NEVER : nextUse[t], NULL);
+        for (int i = 0; ok && i < numWindows; ++i) {
+            ok = lookaheadPush(windows[i], trace[t]);
+        }
+    }
+
+    if (ok) {
+        double lruRate = lru->stats.accesses > 0 ? 100.0 * lru->stats.hits / lru->stats.accesses : 0.0;
+        double optRate = opt->stats.accesses > 0 ? 100.0 * opt->stats.hits / opt->stats.accesses : 0.0;
+        printf("Referencias: %u, frames: %d\n", length, capacity);
+        printf("%-12s %10s %12s %10s\n", "Ventana", "Aciertos%", "Brecha OPT", "Cerrada%");
+        printf("%-12s %9.2f%% %12.2f %10s\n", "lru", lruRate, optRate - lruRate, "-");
+        for (int i = 0; i < numWindows; ++i) {
+            lookaheadFinish(windows[i]);
+            const PolicyStats *s = &windows[i]->policy->stats;
+            double rate = s->accesses > 0 ? 100.0 * s->hits / s->accesses : 0.0;
+            char closed[16] = "-";
+            if (optRate > lruRate) {
+                snprintf(closed, sizeof(closed), "%.1f%%", 100.0 * (rate - lruRate) / (optRate - lruRate));
+            }
+            printf("%-12llu %9.2f%% %12.2f %10s\n", (unsigned long long)sizes[i], rate, optRate - rate, closed);
+        }
+        printf("%-12s %9.2f%% %12.2f %10s\n", "opt", optRate, 0.0, "100.0%");
+    } else {
+        printf("No hay memoria suficiente para las ventanas\n");
+    }
+    for (int i = 0; i < numWindows; ++i) {
+        destroyLookaheadWindow(windows[i]);
+    }
+    destroyPolicy(lru);
+    destroyPolicy(opt);
+    free(nextUse);
+    free(trace);
+    return ok ? 0 : 1;
+}
+
+// Función para leer el TLB de --vm ("conjuntos,vías[,reemplazo]"); devuelve false si no es válido
+bool parseTlbSpec(const char *text, int *sets, int *ways, int *replacement) {
+    char *end;
+    long value = strtol(text, &end, 10);
+    if (end == text || *end != ',' || value < 1 || (value & (value - 1)) != 0 || value > (1 << 20)) {
+        return false;
+    }
+    *sets = (int)value;
+    text = end + 1;
+    value = strtol(text, &end, 10);
+    if (end == text || value < 1 || value > VM_TLB_MAX_WAYS) {
+        return false;
+    }
+    *ways = (int)value;
+    *replacement = TLB_LRU;
+    if (*end == '\0') {
+        return true;
+    }
+    for (int r = 0; r < 3 && *end == ','; ++r) {
+        if (strcmp(end + 1, tlbReplacementNames[r]) == 0) {
+            *replacement = r;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Función para simular una traza con lecturas y escrituras (o una carga sintética) sobre el modelo
+// de memoria virtual de cada política y ordenarlas por el tiempo medio estimado por acceso
+int runVirtualMemory(const char *names, int capacity, const char *path, const char *spec, uint64_t count, uint64_t seed,
+                     const char *tlbText, int levels, const char *latencyText) {
+    int sets, ways, replacement;
+    LatencyModel latency = {1.0, 100.0, 100000.0, 100000.0};
+    if (!parseTlbSpec(tlbText, &sets, &ways, &replacement)) {
+        printf("TLB no válido: %s (conjuntos,vías[,lru|fifo|random])\n", tlbText);
+        return 1;
+    }
+    if (latencyText != NULL && !parseLatencyModel(latencyText, &latency)) {
+        printf("Latencias no válidas: %s\n", latencyText);
+        return 1;
+    }
+    if (levels < 1 || levels > VM_MAX_LEVELS) {
+        printf("La tabla de páginas debe tener de 1 a %d niveles\n", VM_MAX_LEVELS);
+        return 1;
+    }
+    const PolicyOps *ops[NUM_POLICIES];
+    int numPolicies = findPolicyList(names, ops);
+    if (numPolicies <= 0) {
+        return 1;
+    }
+    VmModel *models[NUM_POLICIES];
+    bool ok = true;
+    bool tableFull = false;     // vmAccess no pudo crear una tabla de la tabla de páginas
+    bool needsFuture = false;
+    for (int i = 0; i < numPolicies; ++i) {
+        needsFuture = needsFuture || ops[i]->needsFuture;
+        models[i] = ok ? createVmModel(ops[i], capacity, levels, sets, ways, replacement) : NULL;
+        if (models[i] == NULL && ok) {
+            printf("No hay memoria suficiente para %d frames\n", capacity);
+            ok = false;
+        }
+    }
+
+    if (ok && (needsFuture || spec != NULL)) {
+        uint32_t length = 0;
+        PageId *trace = NULL;
+        uint32_t *nextUse = NULL;
+        if (spec != NULL) {
+            Workload *workload = count < NEVER32 ? createWorkload(spec, seed) : NULL;
+            trace = workload != NULL ? (PageId *)malloc(count * sizeof(PageId)) : NULL;
+            if (trace != NULL) {
+                workload->keepWrites = true;
+                generateWorkload(workload, trace, count);
+                length = (uint32_t)count;
+            } else {
+                printf("Carga no válida o sin memoria suficiente: %s\n", spec);
+            }
+            destroyWorkload(workload);
+        } else {
+            trace = loadTraceReferences(path, &length, true);
+        }
+        if (trace != NULL && needsFuture) {
+            // Los próximos usos se calculan sobre las páginas, sin la marca de escritura
+            PageId *pages = (PageId *)malloc((size_t)length * sizeof(PageId));
+            nextUse = (uint32_t *)malloc(((size_t)length + 1) * sizeof(uint32_t));
+            for (uint32_t t = 0; pages != NULL && t < length; ++t) {
+                pages[t] = referencePage((uint64_t)trace[t]);
+            }
+            if (pages == NULL || nextUse == NULL || !computeNextUse(pages, length, nextUse)) {
+                printf("No hay memoria suficiente para calcular los próximos usos\n");
+                free(trace);
+                trace = NULL;
+            }
+            free(pages);
+        }
+        ok = trace != NULL;
+        for (uint32_t t = 0; ok && t < length; ++t) {
+            uint64_t next = nextUse == NULL || nextUse[t] == NEVER32 ? NEVER : nextUse[t];
+            for (int i = 0; ok && i < numPolicies; ++i) {
+                tableFull = !vmAccess(models[i], (uint64_t)trace[t], next);
+                ok = !tableFull;
+            }
+        }
+        free(trace);
+        free(nextUse);
+    } else if (ok) {
+        TraceReader *reader = openTrace(path);
+        if (reader == NULL) {
+            printf("No se pudo abrir la traza: %s\n", path);
+            ok = false;
+        } else {
+            uint64_t reference;
+            while (ok && nextReference(reader, &reference)) {
+                for (int i = 0; ok && i < numPolicies; ++i) {
+                    tableFull = !vmAccess(models[i], reference, NEVER);
+                    ok = !tableFull;
+                }
+            }
+            ok = ok && !reader->corrupt;
+            closeTrace(reader);
+        }
+    }
+
+    if (ok) {
+        // Ordenar por tiempo estimado (inserción: son pocas políticas)
+        for (int i = 1; i < numPolicies; ++i) {
+            VmModel *model = models[i];
+            double time = vmEstimatedTime(model, &latency);
+            int j = i;
+            while (j > 0 && vmEstimatedTime(models[j - 1], &latency) > time) {
+                models[j] = models[j - 1];
+                j--;
+            }
+            models[j] = model;
+        }
+        printf("Lecturas: %llu, escrituras: %llu\n", (unsigned long long)models[0]->reads, (unsigned long long)models[0]->writes);
+        printf("TLB: %d conjuntos x %d vías (%s), tabla de páginas de %d niveles\n", sets, ways,
+               tlbReplacementNames[replacement], levels);
+        printf("Latencias: TLB %.0f ns, memoria %.0f ns, fallo %.0f ns, escritura %.0f ns\n", latency.tlb, latency.memory,
+               latency.fault, latency.writeBack);
+        printVmHeader();
+        for (int i = 0; i < numPolicies; ++i) {
+            printVmModel(models[i], &latency);
+        }
+    } else if (tableFull) {
+        printf("No hay memoria suficiente para la tabla de páginas\n");
+    }
+    for (int i = 0; i < numPolicies; ++i) {
+        destroyVmModel(models[i]);
+    }
+    return ok ? 0 : 1;
+}
+
+// Patrones de acceso de --scan-bench
+static const char *const benchPatterns[] = {"recorridos", "ciclo", "zipf", "mixta"};
+
+#define NUM_BENCH_PATTERNS ((int)(sizeof(benchPatterns) / sizeof(benchPatterns[0])))
+
+// Función para generar la traza de un patrón de --scan-bench para una memoria de 'capacity' frames:
+//  - recorridos: un conjunto caliente de frames / 2 páginas se interrumpe cada 4 * frames accesos
+//    con un recorrido de 2 * frames páginas nuevas
+//  - ciclo: recorrer una y otra vez 5/4 * frames páginas (LRU y FIFO no aciertan nunca)
+//  - zipf: Zipf (s = 1) sobre 8 * frames páginas
+//  - mixta: fases de Zipf, ciclo y recorrido (ver generateMixed)
+void generateBenchTrace(int pattern, PageId *trace, int capacity) {
+    uint64_t frames = (uint64_t)capacity;
+    WorkloadRng rng;
+    seedWorkloadRng(&rng, frames);
+    if (pattern == 0) {
+        generateScanPolluted(trace, SCAN_BENCH_ACCESSES, frames / 2, 2 * frames, 4 * frames, frames);
+    } else if (pattern == 1) {
+        generateLoop(trace, SCAN_BENCH_ACCESSES, frames + frames / 4, 0);
+    } else if (pattern == 2) {
+        generateZipf(trace, SCAN_BENCH_ACCESSES, 8 * frames, 1.0, 0, &rng);
+    } else {
+        generateMixed(trace, SCAN_BENCH_ACCESSES, frames, frames);
+    }
+}
+
+// Función para comparar las políticas con trazas sintéticas de cada patrón de acceso
+int runScanBenchmark(const char *names, int onlyFrames) {
+    PageId *trace = (PageId *)malloc(SCAN_BENCH_ACCESSES * sizeof(PageId));
+    if (trace == NULL) {
+        printf("No hay memoria suficiente para la traza\n");
+        return 1;
+    }
+    int status = 0;
+    for (int pattern = 0; pattern < NUM_BENCH_PATTERNS && status == 0; ++pattern) {
+        printf("Traza: %s\n", benchPatterns[pattern]);
+        printStatsHeader();
+        for (int frames = 256; frames <= 16384 && status == 0; frames *= 4) {
+            int capacity = onlyFrames > 0 ? onlyFrames : frames;
+            generateBenchTrace(pattern, trace, capacity);
+            Policy *policies[NUM_POLICIES];
+            int numPolicies = createPolicyList(names, capacity, policies);
+            if (numPolicies <= 0) {
+                status = 1;
+                break;
+            }
+            if (replayPages(policies, numPolicies, trace, SCAN_BENCH_ACCESSES, NULL)) {
+                for (int i = 0; i < numPolicies; ++i) {
+                    printPolicyStats(policies[i]);
+                }
+            } else {
+                status = 1;
+            }
+            for (int i = 0; i < numPolicies; ++i) {
+                destroyPolicy(policies[i]);
+            }
+            if (onlyFrames > 0) {
+                break;
+            }
+        }
+        printf("\n");
+    }
+    free(trace);
+    return status;
+}
+
+// Función para reproducir una traza cargada sobre una política y medir los accesos por segundo
+double timeReplay(Policy *policy, const PageId *trace, uint32_t count) {
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < count; ++i) {
+        policyAccess(policy, trace[i], NEVER, NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    return seconds > 0 ? count / seconds : 0.0;
+}
+
+// Función para imprimir una fila de la comparación de --sampled
+void printSampledRow(Policy *policy, const char *samples, const char *pool, double exactHitRate,
+                     size_t bytesPerFrame, double accessesPerSecond) {
+    double hitRate = 100.0 * policy->stats.hits / policy->stats.accesses;
+    printf("%-10s %8s %7s %10.2f%% %+10.2f %12zu %14.0f\n", policy->ops->name, samples, pool, hitRate,
+           hitRate - exactHitRate, bytesPerFrame, accessesPerSecond);
+}
+
+// Función para comparar LRU aproximado por muestreo con LRU exacto sobre una traza (o, si no se
+// indica, Zipf sobre 8 * frames páginas): error en la tasa de aciertos, memoria y rendimiento
+// 'samples' y 'poolSize' menores que 0 recorren los valores por defecto
+int runSampledBenchmark(const char *path, int capacity, int samples, int poolSize) {
+    uint32_t count;
+    PageId *trace;
+    if (path != NULL) {
+        trace = loadTrace(path, &count);
+    } else {
+        count = 4 * (uint32_t)capacity > SCAN_BENCH_ACCESSES ? 4 * (uint32_t)capacity : SCAN_BENCH_ACCESSES;
+        trace = (PageId *)malloc((size_t)count * sizeof(PageId));
+        if (trace != NULL) {
+            WorkloadRng rng;
+            seedWorkloadRng(&rng, (uint64_t)capacity);
+            generateZipf(trace, count, 8 * (uint64_t)capacity, 1.0, 0, &rng);
+        }
+    }
+    if (trace == NULL) {
+        printf("No hay memoria suficiente para la traza\n");
+        return 1;
+    }
+
+    Policy *exact = createPolicy(&lruPolicy, capacity);
+    if (exact == NULL) {
+        printf("No hay memoria suficiente para %d frames\n", capacity);
+        free(trace);
+        return 1;
+    }
+    PageIndex *index = ((LruState *)exact->state)->index;
+    double indexBytes = (double)(index->mask + 1) * sizeof(IndexEntry) / capacity;
+    double exactSpeed = timeReplay(exact, trace, count);
+    double exactHitRate = 100.0 * exact->stats.hits / exact->stats.accesses;
+
+    printf("Frames: %d, accesos: %u (el índice página -> frame ocupa %.1f bytes/frame en ambas)\n",
+           capacity, count, indexBytes);
+    printf("%-11s %8s %7s %11s %10s %12s %14s\n", "Política", "Muestras", "Reserva", "Aciertos%",
+           "Error(pp)", "Bytes/frame", "Accesos/s");
+    printSampledRow(exact, "-", "-", exactHitRate, sizeof(Frame), exactSpeed);
+    destroyPolicy(exact);
+
+    static const int defaultSamples[] = {1, 3, 5, 10};
+    int numSamples = samples > 0 ? 1 : (int)(sizeof(defaultSamples) / sizeof(defaultSamples[0]));
+    int pools[] = {0, SAMPLED_LRU_POOL};
+    int numPools = poolSize >= 0 ? 1 : 2;
+    int status = 0;
+    for (int s = 0; s < numSamples && status == 0; ++s) {
+        for (int p = 0; p < numPools; ++p) {
+            int k = samples > 0 ? samples : defaultSamples[s];
+            int pool = poolSize >= 0 ? poolSize : pools[p];
+            Policy *policy = createPolicy(&sampledLruPolicy, capacity);
+            if (policy == NULL) {
+                printf("No hay memoria suficiente para %d frames\n", capacity);
+                status = 1;
+                break;
+            }
+            sampledLruConfigure(policy->state, k, pool);
+            double speed = timeReplay(policy, trace, count);
+            char samplesText[16], poolText[16];
+            snprintf(samplesText, sizeof(samplesText), "%d", k);
+            snprintf(poolText, sizeof(poolText), "%d", ((SampledLruState *)policy->state)->poolSize);
+            printSampledRow(policy, samplesText, poolText, exactHitRate, sizeof(PageId) + sizeof(uint32_t), speed);
+            destroyPolicy(policy);
+        }
+    }
+    free(trace);
+    return status;
+}
+
+// Trazas sintéticas de --bench
+static const char *const suiteWorkloads[] = {"uniforme", "zipf", "ciclo", "recorridos", "fases"};
+
+#define NUM_SUITE_WORKLOADS ((int)(sizeof(suiteWorkloads) / sizeof(suiteWorkloads[0])))
+
+// Función para escribir la especificación de una traza sintética de --bench para 'frames' frames:
+//  - uniforme: páginas uniformes entre 2 * frames (~50% de aciertos)
+//  - zipf: Zipf (s = 0.99) sobre 8 * frames páginas
+//  - ciclo: recorrer una y otra vez 5/4 * frames páginas
+//  - recorridos: 90% Zipf y 10% de un recorrido que nunca repite páginas
+//  - fases: Zipf sobre 4 * frames páginas que cambian por completo cada cuarto de la traza
+void writeSuiteSpec(int workload, int frames, uint64_t count, char *spec, size_t size) {
+    uint64_t f = (uint64_t)frames;
+    unsigned long long phase = count / 4 > 0 ? count / 4 : 1;
+    if (workload == 0) {
+        snprintf(spec, size, "uniform:%llu", (unsigned long long)(2 * f));
+    } else if (workload == 1) {
+        snprintf(spec, size, "zipf:%llu:0.99", (unsigned long long)(8 * f));
+    } else if (workload == 2) {
+        snprintf(spec, size, "loop:%llu", (unsigned long long)(f + f / 4));
+    } else if (workload == 3) {
+        snprintf(spec, size, "0.9*zipf:%llu:0.99+0.1*scan", (unsigned long long)(8 * f));
+    } else {
+        snprintf(spec, size, "zipf:%llu/%llu;zipf:%llu@%llu/%llu", (unsigned long long)(4 * f), phase,
+                 (unsigned long long)(4 * f), (unsigned long long)(4 * f), phase);
+    }
+}
+
+// Función para medir cada política sobre las trazas sintéticas de --bench y sobre las trazas
+// grabadas, cada caso en su propio proceso; con 'outPath' escribe los resultados en un archivo
+int runBenchSuite(const char *names, int capacity, uint64_t count, uint64_t seed, int repetitions,
+                  const char *outPath, const char *label, const char *const *paths, int numPaths) {
+    if (repetitions < 1 || repetitions > BENCH_MAX_REPETITIONS || count == 0 || count >= NEVER32) {
+        printf("Repeticiones entre 1 y %d y accesos entre 1 y %u\n", BENCH_MAX_REPETITIONS, NEVER32 - 1);
+        return 1;
+    }
+    const PolicyOps *ops[NUM_POLICIES];
+    int numPolicies = findPolicyList(names, ops);
+    if (numPolicies <= 0) {
+        return 1;
+    }
+    int numTraces = NUM_SUITE_WORKLOADS + numPaths;
+    BenchResult *results = (BenchResult *)calloc((size_t)numTraces * numPolicies, sizeof(BenchResult));
+    if (results == NULL) {
+        printf("No hay memoria suficiente para los resultados\n");
+        return 1;
+    }
+
+    printf("%d repeticiones medidas después de %d de calentamiento; reservas de memoria %s\n", repetitions, BENCH_WARMUP,
+           BENCH_ALLOCATIONS_COUNTED ? "contadas" : "no disponibles (compilar con BENCH_COUNT_ALLOCATIONS)");
+    printBenchHeader();
+    int numResults = 0;
+    int status = 0;
+    for (int t = 0; t < numTraces && status == 0; ++t) {
+        char name[64];
+        uint32_t length;
+        PageId *trace;
+        if (t < NUM_SUITE_WORKLOADS) {
+            char spec[128];
+            writeSuiteSpec(t, capacity, count, spec, sizeof(spec));
+            snprintf(name, sizeof(name), "%s", suiteWorkloads[t]);
+            Workload *workload = createWorkload(spec, seed);
+            trace = workload != NULL ? (PageId *)malloc(count * sizeof(PageId)) : NULL;
+            if (trace != NULL) {
+                generateWorkload(workload, trace, count);
+            }
+            destroyWorkload(workload);
+            length = (uint32_t)count;
+        } else {
+            const char *path = paths[t - NUM_SUITE_WORKLOADS];
+            const char *base = strrchr(path, '/');
+            snprintf(name, sizeof(name), "%s", base != NULL ? base + 1 : path);
+            trace = loadTrace(path, &length);
+        }
+        if (trace == NULL || length == 0) {
+            printf("No se pudo preparar la traza %s\n", name);
+            free(trace);
+            status = 1;
+            break;
+        }
+        for (int i = 0; i < numPolicies; ++i) {
+            BenchResult *result = &results[numResults];
+            if (!runIsolatedBenchCase(ops[i], capacity, trace, length, BENCH_WARMUP, repetitions, result)) {
+                printf("No se pudo medir %s con la traza %s\n", ops[i]->name, name);
+                status = 1;
+                break;
+            }
+            snprintf(result->trace, sizeof(result->trace), "%s", name);
+            printBenchResult(result);
+            numResults++;
+        }
+        free(trace);
+    }
+    if (status == 0 && outPath != NULL) {
+        if (writeBenchResults(outPath, label, results, numResults)) {
+            printf("Resultados: %s\n", outPath);
+        } else {
+            printf("No se pudieron escribir los resultados: %s\n", outPath);
+            status = 1;
+        }
+    }
+    free(results);
+    return status;
+}
+
+// Función para leer el valor entero de una opción (de min a max); si no es válido lo informa y
+// devuelve false
+bool parseIntOption(const char *option, const char *text, long min, long max, int *value) {
+    char *end;
+    errno = 0;
+    long number = strtol(text, &end, 10);
+    if (end == text || *end != '\0') {
+        printf("Valor no válido para %s (no es un número): %s\n", option, text);
+        return false;
+    }
+    if (errno == ERANGE || number < min || number > max) {
+        printf("Valor fuera de rango para %s (de %ld a %ld): %s\n", option, min, max, text);
+        return false;
+    }
+    *value = (int)number;
+    return true;
+}
+
+// Función para leer el valor real no negativo de una opción; si no es válido lo informa y
+// devuelve false
+bool parseDoubleOption(const char *option, const char *text, double *value) {
+    char *end;
+    double number = strtod(text, &end);
+    if (end == text || *end != '\0' || !isfinite(number)) {
+        printf("Valor no válido para %s (no es un número): %s\n", option, text);
+        return false;
+    }
+    if (number < 0.0) {
+        printf("Valor fuera de rango para %s (no puede ser negativo): %s\n", option, text);
+        return false;
+    }
+    *value = number;
+    return true;
+}
+
+// Función para leer un entero sin signo de 64 bits (semillas); si no es válido lo informa y
+// devuelve false
+bool parseUint64Option(const char *option, const char *text, uint64_t *value) {
+    char *end;
+    errno = 0;
+    uint64_t number = strtoull(text, &end, 10);
+    if (*text < '0' || *text > '9' || *end != '\0') {
+        printf("Valor no válido para %s (no es un número): %s\n", option, text);
+        return false;
+    }
+    if (errno == ERANGE) {
+        printf("Valor fuera de rango para %s (no cabe en 64 bits): %s\n", option, text);
+        return false;
+    }
+    *value = number;
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    int capacity = 0;
+    bool mrc = false;
+    bool verify = false;
+    bool sweep = false;
+    bool concurrent = false;
+    bool scanBench = false;
+    bool sampled = false;
+    bool bench = false;
+    int repetitions = BENCH_REPETITIONS;
+    const char *outPath = NULL;
+    const char *label = "local";
+    const char *allocationMode = NULL;
+    bool virtualMemory = false;
+    const char *tlbText = VM_TLB;
+    int levels = VM_LEVELS;
+    const char *latencyText = NULL;
+    const char *tierText = NULL;
+    const char *lookaheadText = NULL;
+    const char *tierMode = "both";
+    double missLatency = TIER_MISS_LATENCY;
+    int samples = -1;
+    int poolSize = -1;
+    int numShards = DEFAULT_SHARDS;
+    bool counters = false;
+    const char *eventsPath = NULL;
+    const char *convertPath = NULL;
+    const char *formatName = traceFormats[0].name;
+    int numWorkers = 0;
+    const char *framesList = NULL;
+    uint64_t count = 0;
+    const char *workloadSpec = NULL;
+    const char *generateSpec = NULL;
+    uint64_t seed = 1;
+    const char *names = NULL;
+    const char *paths[BENCH_MAX_TRACES];
+    int numPaths = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            framesList = argv[++i];
+            if (!parseFrameCount(framesList, ',', &capacity)) {
+                printf("Número de frames no válido: %s\n", framesList);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+            names = argv[++i];
+        } else if (strcmp(argv[i], "-c") == 0) {
+            counters = true;
+        } else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc) {
+            eventsPath = argv[++i];
+        } else if (strcmp(argv[i], "--mrc") == 0) {
+            mrc = true;
+        } else if (strcmp(argv[i], "--sweep") == 0) {
+            sweep = true;
+        } else if (strcmp(argv[i], "--scan-bench") == 0) {
+            scanBench = true;
+        } else if (strcmp(argv[i], "--concurrent") == 0) {
+            concurrent = true;
+        } else if (strcmp(argv[i], "--sampled") == 0) {
+            sampled = true;
+        } else if (strcmp(argv[i], "--bench") == 0) {
+            bench = true;
+        } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            if (!parseIntOption("-r", argv[++i], 1, BENCH_MAX_REPETITIONS, &repetitions)) {
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            outPath = argv[++i];
+        } else if (strcmp(argv[i], "--vm") == 0) {
+            virtualMemory = true;
+        } else if (strcmp(argv[i], "--tlb") == 0 && i + 1 < argc) {
+            tlbText = argv[++i];
+        } else if (strcmp(argv[i], "--levels") == 0 && i + 1 < argc) {
+            if (!parseIntOption("--levels", argv[++i], 1, VM_MAX_LEVELS, &levels)) {
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--latency") == 0 && i + 1 < argc) {
+            latencyText = argv[++i];
+        } else if (strcmp(argv[i], "--lookahead") == 0 && i + 1 < argc) {
+            lookaheadText = argv[++i];
+        } else if (strcmp(argv[i], "--tiers") == 0 && i + 1 < argc) {
+            tierText = argv[++i];
+        } else if (strcmp(argv[i], "--tier-mode") == 0 && i + 1 < argc) {
+            tierMode = argv[++i];
+        } else if (strcmp(argv[i], "--miss") == 0 && i + 1 < argc) {
+            if (!parseDoubleOption("--miss", argv[++i], &missLatency)) {
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--processes") == 0 && i + 1 < argc) {
+            allocationMode = argv[++i];
+        } else if (strcmp(argv[i], "--label") == 0 && i + 1 < argc) {
+            label = argv[++i];
+        } else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) {
+            if (!parseIntOption("-k", argv[++i], 1, MAX_FRAMES, &samples)) {
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--pool") == 0 && i + 1 < argc) {
+            if (!parseIntOption("--pool", argv[++i], 0, SAMPLED_LRU_MAX_POOL, &poolSize)) {
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--shards") == 0 && i + 1 < argc) {
+            if (!parseIntOption("--shards", argv[++i], 1, MAX_FRAMES, &numShards)) {
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            if (!parseIntOption("-t", argv[++i], 1, INT32_MAX, &numWorkers)) {
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--convert") == 0 && i + 1 < argc) {
+            convertPath = argv[++i];
+        } else if (strcmp(argv[i], "--format") == 0 && i + 1 < argc) {
+            formatName = argv[++i];
+        } else if (strcmp(argv[i], "--verify") == 0) {
+            verify = true;
+        } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            const char *text = argv[++i];
+            if (!parseWorkloadCount(&text, &count) || *text != '\0') {
+                printf("Valor no válido para -n (no es un número): %s\n", argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+            workloadSpec = argv[++i];
+        } else if (strcmp(argv[i], "--generate") == 0 && i + 1 < argc) {
+            generateSpec = argv[++i];
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            if (!parseUint64Option("-s", argv[++i], &seed)) {
+                return 1;
+            }
+        } else if (numPaths < BENCH_MAX_TRACES && (argv[i][0] != '-' || argv[i][1] == '\0')) {
+            paths[numPaths++] = argv[i];
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    // Solo --bench admite varias trazas
+    const char *path = numPaths > 0 ? paths[0] : NULL;
+    if (numPaths > 1 && !bench) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    // Solo --sweep admite una lista de números de frames
+    if (framesList != NULL && strchr(framesList, ',') != NULL && !sweep) {
+        printf("Solo --sweep admite varios números de frames: %s\n", framesList);
+        return 1;
+    }
+    if (verify) {
+        if (count > INT32_MAX) {
+            printf("Demasiadas trazas para --verify (máximo %d)\n", INT32_MAX);
+            return 1;
+        }
+        return verifyPolicies(seed, count > 0 ? (int)count : 1000) ? 0 : 1;
+    }
+    if (scanBench) {
+        return runScanBenchmark(names, capacity);
+    }
+    if (concurrent) {
+        return runConcurrentBenchmark(names != NULL ? names : "clock,lru", capacity > 0 ? capacity : CONCURRENT_FRAMES, numShards);
+    }
+    if (bench) {
+        return runBenchSuite(names, capacity > 0 ? capacity : BENCH_FRAMES, count > 0 ? count : BENCH_SUITE_ACCESSES, seed,
+                             repetitions, outPath, label, paths, numPaths);
+    }
+    if (sampled) {
+        return runSampledBenchmark(path, capacity > 0 ? capacity : SAMPLED_FRAMES, samples, poolSize);
+    }
+    if (generateSpec != NULL && path != NULL) {
+        return runWorkloadGeneration(generateSpec, count > 0 ? count : WORKLOAD_ACCESSES, seed, path, formatName);
+    }
+    // Una carga sintética (-w) reemplaza a la traza solo en la simulación normal, --processes, --vm,
+    // --tiers y --lookahead
+    bool simulate = !mrc && !sweep && convertPath == NULL && generateSpec == NULL;
+    if ((path == NULL) == (workloadSpec == NULL) || (workloadSpec != NULL && !simulate)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    if (lookaheadText != NULL) {
+        return runLookahead(lookaheadText, capacity > 0 ? capacity : DEFAULT_FRAMES, path, workloadSpec,
+                            count > 0 ? count : WORKLOAD_ACCESSES, seed);
+    }
+    if (tierText != NULL) {
+        return runTieredCache(tierText, tierMode, missLatency, path, workloadSpec, count > 0 ? count : WORKLOAD_ACCESSES,
+                              seed);
+    }
+    if (virtualMemory) {
+        return runVirtualMemory(names, capacity > 0 ? capacity : DEFAULT_FRAMES, path, workloadSpec,
+                                count > 0 ? count : WORKLOAD_ACCESSES, seed, tlbText, levels, latencyText);
+    }
+    if (allocationMode != NULL) {
+        return runFrameAllocation(allocationMode, names, capacity > 0 ? capacity : DEFAULT_FRAMES, path, workloadSpec,
+                                  count > 0 ? count : WORKLOAD_ACCESSES, seed);
+    }
+    if (convertPath != NULL) {
+        return runTraceConversion(path, convertPath, formatName);
+    }
+    if (mrc) {
+        return runMissRatioCurve(path, capacity);
+    }
+    if (sweep) {
+        char allNames[256];
+        if (names == NULL) {
+            listAllPolicies(allNames, sizeof(allNames));
+            names = allNames;
+        }
+        if (framesList == NULL) {
+            framesList = "4";
+        }
+        return runParallelSweep(names, framesList, numWorkers > 0 ? numWorkers : sweepDefaultWorkers(), path);
+    }
+    if (capacity == 0) {
+        capacity = DEFAULT_FRAMES;
+    }
+
+    // Crear una instancia de cada política (por defecto todas)
+    Policy *policies[NUM_POLICIES];
+    int numPolicies = createPolicyList(names, capacity, policies);
+    if (numPolicies <= 0) {
+        return 1;
+    }
+    bool ok = true;
+    for (int i = 0; i < numPolicies && counters && ok; ++i) {
+        ok = policyTrackFaults(policies[i]);
+    }
+    EventLog *events = NULL;
+    if (ok && eventsPath != NULL) {
+        events = createEventLog(eventsPath);
+        if (events == NULL) {
+            printf("No se pudo crear el registro de eventos: %s\n", eventsPath);
+            ok = false;
+        }
+    }
+
+    // Reproducir la traza (o la carga sintética) una sola vez sobre todas las políticas
+    if (workloadSpec != NULL) {
+        ok = ok && replayWorkload(policies, numPolicies, workloadSpec, count > 0 ? count : WORKLOAD_ACCESSES, seed, events);
+    } else {
+        ok = ok && replayTrace(policies, numPolicies, path, events);
+    }
+    if (events != NULL && !closeEventLog(events) && ok) {
+        printf("Error al escribir el registro de eventos: %s\n", eventsPath);
+        ok = false;
+    }
+    if (ok) {
+        printStatsHeader();
+        for (int i = 0; i < numPolicies; ++i) {
+            printPolicyStats(policies[i]);
+        }
+    }
+    if (ok && counters) {
+        printf("\n");
+        printCountersHeader();
+        for (int i = 0; i < numPolicies; ++i) {
+            printPolicyCounters(policies[i]);
+        }
+        for (int i = 0; i < numPolicies; ++i) {
+            printf("\n");
+            printPageFaults(policies[i], TOP_FAULT_PAGES);
+        }
+    }
+
+    for (int i = 0; i < numPolicies; ++i) {
+        destroyPolicy(policies[i]);
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,132 @@
+#ifndef SMALL_SET_H
+#define SMALL_SET_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "FRAME_LIST.h"
+
+// Conjunto pequeño de páginas residentes: con pocos frames es más rápido comparar la página
+// contra todas las ranuras de un arreglo contiguo que dispersarla en un índice. El arreglo está
+// alineado a la línea de caché y se rellena con NO_PAGE hasta un múltiplo de SMALL_SET_LANES,
+// así la búsqueda recorre líneas completas sin caso especial para el final.
+// La búsqueda usa comparaciones AVX2 (4 páginas por instrucción) o SSE4.1 (2 por instrucción)
+// cuando el procesador las tiene, elegidas una sola vez al crear el conjunto, y si no un ciclo
+// escalar. Como en el índice, la página NO_PAGE no puede buscarse.
+// Las políticas solo lo usan hasta una línea de caché (8 frames): la búsqueda se llama por un
+// puntero y desde 16 frames ya cuesta más que el índice (ver "FI_FO bench").
+
+#define SMALL_SET_LANES (CACHE_LINE / (int)sizeof(PageId))   // Páginas por línea de caché
+#define SMALL_SET_MAX_FRAMES SMALL_SET_LANES   // Con más frames las políticas usan el índice
+#define SMALL_SET_MAX_SLOTS 64                 // Ranuras como máximo (bits de la máscara)
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SMALL_SET_X86 1
+#include <immintrin.h>
+#else
+#define SMALL_SET_X86 0
+#endif
+
+// Función de búsqueda: devuelve la ranura de la página o -1 si no está
+typedef int (*SmallSetFind)(const PageId *pages, int slots, PageId page);
+
+// Implementación de la búsqueda con el nombre del juego de instrucciones que usa
+typedef struct SmallSetKernel {
+    const char *name;
+    SmallSetFind find;
+} SmallSetKernel;
+
+// Función para obtener el número de ranuras (con relleno) de un conjunto de 'capacity' páginas
+static inline int smallSetSlots(int capacity) {
+    int lines = (capacity + SMALL_SET_LANES - 1) / SMALL_SET_LANES;
+    return (lines > 0 ? lines : 1) * SMALL_SET_LANES;
+}
+
+// Función para crear el arreglo de un conjunto pequeño con todas las ranuras en NO_PAGE
+static inline PageId* createSmallSet(int capacity) {
+    int slots = smallSetSlots(capacity);
+    void *pages = NULL;
+    if (posix_memalign(&pages, CACHE_LINE, (size_t)slots * sizeof(PageId)) != 0) {
+        return NULL;
+    }
+    for (int i = 0; i < slots; ++i) {
+        ((PageId *)pages)[i] = NO_PAGE;
+    }
+    return (PageId *)pages;
+}
+
+// Las búsquedas comparan todas las ranuras y arman una máscara de coincidencias en lugar de salir
+// al primer acierto: el número de vueltas depende solo del tamaño del conjunto, así que no hay
+// saltos que dependan de la página (que con ~50% de aciertos se predicen mal y cuestan más que la
+// comparación). Por eso un conjunto tiene a lo sumo SMALL_SET_MAX_SLOTS ranuras.
+
+// Función para buscar una página comparando ranura por ranura
+static inline int smallSetFindScalar(const PageId *pages, int slots, PageId page) {
+    uint64_t mask = 0;
+    for (int i = 0; i < slots; ++i) {
+        mask |= (uint64_t)(pages[i] == page) << i;
+    }
+    return mask != 0 ? __builtin_ctzll(mask) : -1;
+}
+
+#if SMALL_SET_X86
+// Función para buscar una página con SSE4.1: compara una línea de caché (8 páginas) por vuelta
+__attribute__((target("sse4.1")))
+static inline int smallSetFindSse41(const PageId *pages, int slots, PageId page) {
+    __m128i key = _mm_set1_epi64x(page);
+    uint64_t mask = 0;
+    for (int i = 0; i < slots; i += SMALL_SET_LANES) {
+        const __m128i *line = (const __m128i *)(pages + i);
+        uint64_t a = (uint64_t)_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(_mm_load_si128(line), key)));
+        uint64_t b = (uint64_t)_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(_mm_load_si128(line + 1), key)));
+        uint64_t c = (uint64_t)_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(_mm_load_si128(line + 2), key)));
+        uint64_t d = (uint64_t)_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(_mm_load_si128(line + 3), key)));
+        mask |= (a | b << 2 | c << 4 | d << 6) << i;
+    }
+    return mask != 0 ? __builtin_ctzll(mask) : -1;
+}
+
+// Función para buscar una página con AVX2: compara una línea de caché (8 páginas) por vuelta
+__attribute__((target("avx2")))
+static inline int smallSetFindAvx2(const PageId *pages, int slots, PageId page) {
+    __m256i key = _mm256_set1_epi64x(page);
+    uint64_t mask = 0;
+    for (int i = 0; i < slots; i += SMALL_SET_LANES) {
+        const __m256i *line = (const __m256i *)(pages + i);
+        uint64_t low = (uint64_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_load_si256(line), key)));
+        uint64_t high = (uint64_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_load_si256(line + 1), key)));
+        mask |= (low | high << 4) << i;
+    }
+    return mask != 0 ? __builtin_ctzll(mask) : -1;
+}
+#endif
+
+// Función para obtener las implementaciones que puede ejecutar este procesador, de la más
+// rápida a la más lenta (la escalar siempre está al final); devuelve cuántas son
+static inline int smallSetKernels(SmallSetKernel kernels[3]) {
+    int count = 0;
+#if SMALL_SET_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        kernels[count].name = "avx2";
+        kernels[count++].find = smallSetFindAvx2;
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        kernels[count].name = "sse4.1";
+        kernels[count++].find = smallSetFindSse41;
+    }
+#endif
+    kernels[count].name = "escalar";
+    kernels[count++].find = smallSetFindScalar;
+    return count;
+}
+
+// Función para elegir la búsqueda más rápida que puede ejecutar este procesador
+static inline SmallSetFind smallSetBestFind() {
+    SmallSetKernel kernels[3];
+    smallSetKernels(kernels);
+    return kernels[0].find;
+}
+
+#endif
@@ -0,0 +1,317 @@
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "POLICY.h"
+#include "REPLAY.h"
+
+// Barrido de muchas configuraciones (política, frames) sobre una misma traza en paralelo.
+// El hilo principal decodifica la traza una sola vez en bloques que se publican en un anillo
+// acotado; cada hilo trabajador recorre todos los bloques en orden y los aplica a sus propias
+// configuraciones (la configuración c la simula el hilo c % hilos). Un bloque se recicla cuando
+// todos los trabajadores terminaron con él, así que la memoria usada no depende del largo de la
+// traza. Si alguna política necesita el futuro (OPT) la traza se carga completa para calcular
+// los próximos usos y los bloques son vistas sobre esos arreglos.
+// Con una traza comprimida cada bloque de la traza se publica como un bloque del anillo: los
+// bloques sin comprimir se leen directamente del mmap y con OPT solo se guardan los próximos
+// usos (calculados hacia atrás por bloques), no la traza.
+// Requiere compilar con -pthread.
+
+#define SWEEP_CHUNK_SIZE (1 << 16)   // Referencias por bloque
+#define SWEEP_RING_SIZE 8            // Bloques que pueden estar en circulación a la vez
+
+// Configuración del barrido: una política con un número de frames y sus resultados
+typedef struct SweepConfig {
+    const PolicyOps *ops;   // Política a simular
+    int capacity;           // Número de frames
+    Policy *policy;         // Instancia creada por el trabajador dueño (NULL si no hubo memoria)
+} SweepConfig;
+
+// Bloque de referencias compartido (solo lectura para los trabajadores)
+typedef struct SweepChunk {
+    PageId *buffer;             // Búfer propio del bloque (modo sin futuro o traza comprimida)
+    const PageId *pages;        // Referencias del bloque
+    const uint32_t *nextUse;    // Próximo uso de cada referencia (NULL si no se necesita)
+    uint32_t count;             // Número de referencias del bloque
+    int pending;                // Trabajadores que aún no procesan el bloque
+} SweepChunk;
+
+// Estado compartido del barrido
+typedef struct Sweep {
+    SweepConfig *configs;       // Configuraciones a simular
+    int numConfigs;             // Número de configuraciones
+    int numWorkers;             // Número de hilos trabajadores
+    SweepChunk ring[SWEEP_RING_SIZE];
+    uint64_t produced;          // Número de bloques publicados
+    bool done;                  // Indica si ya no se publicarán más bloques
+    pthread_mutex_t lock;       // Protege produced, done y pending
+    pthread_cond_t chunkReady;  // Se señala al publicar un bloque o al terminar
+    pthread_cond_t chunkFree;   // Se señala cuando un bloque queda libre
+} Sweep;
+
+// Argumentos de un hilo trabajador
+typedef struct SweepWorker {
+    Sweep *sweep;               // Estado compartido
+    int id;                     // Número de trabajador (0..numWorkers-1)
+    pthread_t thread;           // Hilo del trabajador
+} SweepWorker;
+
+// Función que ejecuta cada trabajador: simula sus configuraciones bloque por bloque
+static void* sweepWorker(void *arg) {
+    SweepWorker *worker = (SweepWorker *)arg;
+    Sweep *sweep = worker->sweep;
+
+    // Las políticas se crean en el propio hilo para que su memoria no comparta líneas de caché
+    // con las de otros trabajadores
+    for (int c = worker->id; c < sweep->numConfigs; c += sweep->numWorkers) {
+        sweep->configs[c].policy = createPolicy(sweep->configs[c].ops, sweep->configs[c].capacity);
+    }
+
+    for (uint64_t next = 0;; ++next) {
+        pthread_mutex_lock(&sweep->lock);
+        while (sweep->produced == next && !sweep->done) {
+            pthread_cond_wait(&sweep->chunkReady, &sweep->lock);
+        }
+        bool finished = sweep->produced == next;
+        pthread_mutex_unlock(&sweep->lock);
+        if (finished) {
+            break;
+        }
+
+        SweepChunk *chunk = &sweep->ring[next % SWEEP_RING_SIZE];
+        for (int c = worker->id; c < sweep->numConfigs; c += sweep->numWorkers) {
+            Policy *policy = sweep->configs[c].policy;
+            if (policy == NULL) {
+                continue;
+            }
+            for (uint32_t i = 0; i < chunk->count; ++i) {
+                uint64_t nextUse = chunk->nextUse == NULL || chunk->nextUse[i] == NEVER32 ? NEVER : chunk->nextUse[i];
+                policyAccess(policy, referencePage((uint64_t)chunk->pages[i]), nextUse, NULL);
+            }
+        }
+
+        pthread_mutex_lock(&sweep->lock);
+        if (--chunk->pending == 0) {
+            pthread_cond_signal(&sweep->chunkFree);
+        }
+        pthread_mutex_unlock(&sweep->lock);
+    }
+    return NULL;
+}
+
+// Función para esperar a que el siguiente bloque del anillo quede libre
+static inline SweepChunk* sweepAcquireChunk(Sweep *sweep) {
+    SweepChunk *chunk = &sweep->ring[sweep->produced % SWEEP_RING_SIZE];
+    pthread_mutex_lock(&sweep->lock);
+    while (chunk->pending > 0) {
+        pthread_cond_wait(&sweep->chunkFree, &sweep->lock);
+    }
+    pthread_mutex_unlock(&sweep->lock);
+    return chunk;
+}
+
+// Función para publicar un bloque ya lleno a todos los trabajadores
+static inline void sweepPublishChunk(Sweep *sweep, SweepChunk *chunk) {
+    pthread_mutex_lock(&sweep->lock);
+    chunk->pending = sweep->numWorkers;
+    sweep->produced++;
+    pthread_cond_broadcast(&sweep->chunkReady);
+    pthread_mutex_unlock(&sweep->lock);
+}
+
+// Función para publicar los bloques de una traza comprimida; los próximos usos son opcionales
+static inline bool sweepBlockedTrace(Sweep *sweep, TraceReader *reader, const uint32_t *nextUse) {
+    for (uint32_t block = 0; block < reader->numBlocks; ++block) {
+        SweepChunk *chunk = sweepAcquireChunk(sweep);
+        const uint64_t *pages;
+        chunk->count = readTraceBlock(reader, block, (uint64_t *)chunk->buffer, &pages);
+        if (chunk->count == 0) {
+            printf("El bloque %u de la traza comprimida no es válido\n", block);
+            return false;
+        }
+        chunk->pages = (const PageId *)pages;
+        chunk->nextUse = nextUse != NULL ? nextUse + (size_t)block * reader->blockSize : NULL;
+        sweepPublishChunk(sweep, chunk);
+    }
+    return true;
+}
+
+// Función para indicar si los bloques de una traza comprimida caben en los del anillo
+static inline bool sweepUsesBlocks(const TraceReader *reader) {
+    return reader->format == TRACE_BLOCKED && reader->blockSize <= SWEEP_CHUNK_SIZE;
+}
+
+// Función para decodificar la traza en bloques y publicarlos (modo sin futuro)
+// Una traza comprimida queda abierta en *blocked (sus bloques pueden estar en uso hasta que
+// terminen los trabajadores)
+static inline bool sweepStreamTrace(Sweep *sweep, const char *path, TraceReader **blocked) {
+    TraceReader *reader = openTrace(path);
+    if (reader == NULL) {
+        printf("No se pudo abrir la traza: %s\n", path);
+        return false;
+    }
+    if (sweepUsesBlocks(reader)) {
+        *blocked = reader;
+        return sweepBlockedTrace(sweep, reader, NULL);
+    }
+    bool more = true;
+    while (more) {
+        SweepChunk *chunk = sweepAcquireChunk(sweep);
+        uint64_t page;
+        chunk->count = 0;
+        while (chunk->count < SWEEP_CHUNK_SIZE && (more = nextPage(reader, &page))) {
+            chunk->buffer[chunk->count++] = (PageId)page;
+        }
+        chunk->pages = chunk->buffer;
+        chunk->nextUse = NULL;
+        if (chunk->count > 0) {
+            sweepPublishChunk(sweep, chunk);
+        }
+    }
+    bool ok = !reader->corrupt;
+    closeTrace(reader);
+    return ok;
+}
+
+// Función para cargar la traza completa con sus próximos usos y publicarla por bloques
+// (de una traza comprimida solo se calculan los próximos usos y queda abierta en *blocked)
+static inline bool sweepLoadedTrace(Sweep *sweep, const char *path, PageId **trace, uint32_t **nextUse, TraceReader **blocked) {
+    TraceReader *reader = strcmp(path, "-") != 0 ? openTrace(path) : NULL;
+    if (reader != NULL && sweepUsesBlocks(reader)) {
+        *blocked = reader;
+        if (reader->total >= NEVER32) {
+            printf("La traza supera el máximo de %u referencias\n", NEVER32 - 1);
+            return false;
+        }
+        *nextUse = (uint32_t *)malloc(((size_t)reader->total + 1) * sizeof(uint32_t));
+        if (*nextUse == NULL) {
+            printf("No hay memoria suficiente para calcular los próximos usos\n");
+            return false;
+        }
+        return computeTraceNextUse(reader, *nextUse) && sweepBlockedTrace(sweep, reader, *nextUse);
+    }
+    if (reader != NULL) {
+        closeTrace(reader);
+    }
+
+    uint32_t count;
+    *trace = loadTrace(path, &count);
+    if (*trace == NULL) {
+        return false;
+    }
+    *nextUse = (uint32_t *)malloc(((size_t)count + 1) * sizeof(uint32_t));
+    if (*nextUse == NULL || !computeNextUse(*trace, count, *nextUse)) {
+        printf("No hay memoria suficiente para calcular los próximos usos\n");
+        return false;
+    }
+    for (uint32_t start = 0; start < count; start += SWEEP_CHUNK_SIZE) {
+        SweepChunk *chunk = sweepAcquireChunk(sweep);
+        chunk->pages = *trace + start;
+        chunk->nextUse = *nextUse + start;
+        chunk->count = count - start < SWEEP_CHUNK_SIZE ? count - start : SWEEP_CHUNK_SIZE;
+        sweepPublishChunk(sweep, chunk);
+    }
+    return true;
+}
+
+// Función para simular todas las configuraciones sobre la traza con 'numWorkers' hilos
+// Deja en cada configuración su instancia de política con los contadores finales
+static inline bool runSweep(SweepConfig *configs, int numConfigs, int numWorkers, const char *path) {
+    Sweep sweep;
+    memset(&sweep, 0, sizeof(sweep));
+    sweep.configs = configs;
+    sweep.numConfigs = numConfigs;
+    sweep.numWorkers = numWorkers < numConfigs ? numWorkers : numConfigs;
+    if (sweep.numWorkers < 1) {
+        sweep.numWorkers = 1;
+    }
+
+    bool needsFuture = false;
+    for (int c = 0; c < numConfigs; ++c) {
+        configs[c].policy = NULL;
+        needsFuture = needsFuture || configs[c].ops->needsFuture;
+    }
+
+    bool ok = true;
+    for (int i = 0; i < SWEEP_RING_SIZE && ok; ++i) {
+        sweep.ring[i].buffer = (PageId *)malloc(SWEEP_CHUNK_SIZE * sizeof(PageId));
+        ok = sweep.ring[i].buffer != NULL;
+    }
+    SweepWorker *workers = (SweepWorker *)calloc((size_t)sweep.numWorkers, sizeof(SweepWorker));
+    if (!ok || workers == NULL) {
+        printf("No hay memoria suficiente para el barrido\n");
+        for (int i = 0; i < SWEEP_RING_SIZE; ++i) {
+            free(sweep.ring[i].buffer);
+        }
+        free(workers);
+        return false;
+    }
+
+    pthread_mutex_init(&sweep.lock, NULL);
+    pthread_cond_init(&sweep.chunkReady, NULL);
+    pthread_cond_init(&sweep.chunkFree, NULL);
+    int started = 0;
+    for (; started < sweep.numWorkers; ++started) {
+        workers[started].sweep = &sweep;
+        workers[started].id = started;
+        if (pthread_create(&workers[started].thread, NULL, sweepWorker, &workers[started]) != 0) {
+            break;
+        }
+    }
+    if (started < sweep.numWorkers) {
+        printf("Solo se pudieron crear %d de %d hilos\n", started, sweep.numWorkers);
+        ok = false;
+    }
+
+    PageId *trace = NULL;
+    uint32_t *nextUse = NULL;
+    TraceReader *blocked = NULL;
+    if (ok) {
+        ok = needsFuture ? sweepLoadedTrace(&sweep, path, &trace, &nextUse, &blocked)
+                         : sweepStreamTrace(&sweep, path, &blocked);
+    }
+
+    pthread_mutex_lock(&sweep.lock);
+    sweep.done = true;
+    pthread_cond_broadcast(&sweep.chunkReady);
+    pthread_mutex_unlock(&sweep.lock);
+    for (int i = 0; i < started; ++i) {
+        pthread_join(workers[i].thread, NULL);
+    }
+
+    for (int c = 0; c < numConfigs && ok; ++c) {
+        if (configs[c].policy == NULL) {
+            printf("No hay memoria suficiente para %d frames\n", configs[c].capacity);
+            ok = false;
+        }
+    }
+
+    pthread_cond_destroy(&sweep.chunkFree);
+    pthread_cond_destroy(&sweep.chunkReady);
+    pthread_mutex_destroy(&sweep.lock);
+    for (int i = 0; i < SWEEP_RING_SIZE; ++i) {
+        free(sweep.ring[i].buffer);
+    }
+    free(workers);
+    free(nextUse);
+    free(trace);
+    if (blocked != NULL) {
+        closeTrace(blocked);
+    }
+    return ok;
+}
+
+// Función para obtener el número de núcleos disponibles
+static inline int sweepDefaultWorkers() {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores > 0 ? (int)cores : 1;
+}
+
+#endif
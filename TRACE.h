@@ -0,0 +1,711 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "FRAME_LIST.h"
+
+// Formatos de traza soportados:
+//  - Texto: números de página decimales separados por espacios o saltos de línea
+//    (un '#' donde empieza una referencia comenta hasta el final de la línea). Cualquier otro
+//    carácter (un signo, un punto decimal, una coma) o un número que no cabe en 64 bits (los
+//    ceros a la izquierda no cuentan) dejan la traza como no válida en lugar de adivinar qué
+//    quería decir. Una referencia "proceso:página" se lee como la página con el proceso en los
+//    bits altos (ver PID_SHIFT en FRAME_LIST.h); un proceso mayor que MAX_PID o una página que no
+//    cabe en PID_SHIFT bits también dejan la traza como no válida. Una 'W' (o 'R') después del
+//    número marca una escritura (o una lectura, que es lo que se supone si no hay marca); una
+//    página que no cabe en 63 bits deja la traza como no válida
+//  - Binario: cabecera de 8 bytes ("PGTR", ancho en bytes 4 u 8, versión, 2 bytes reservados)
+//    seguida de los números de página como enteros sin signo little-endian (otro ancho, otra
+//    versión, o bytes sobrantes al final que no completan un número, dejan la traza como no válida)
+//  - Comprimido por bloques: cabecera de 32 bytes ("PGTR", ancho 0, versión, 2 bytes reservados,
+//    referencias por bloque (32 bits), número de bloques (32 bits), número de referencias (64 bits)
+//    y posición del índice (64 bits)), los bloques y al final el índice de bloques. Cada bloque
+//    guarda la diferencia con la página anterior en zigzag y varint (LEB128); la primera página de
+//    cada bloque es relativa a 0, así que cualquier bloque se decodifica sin leer los anteriores.
+//    Un bloque que no se achica así se guarda sin comprimir (enteros de 64 bits alineados a 8
+//    bytes) y se lee directamente del mmap sin copiarlo. Solo se puede leer de un archivo regular
+//    (necesita mmap para saltar a cualquier bloque).
+// En los formatos de 64 bits y comprimido una escritura se guarda con el bit WRITE_FLAG encendido
+// desde la versión TRACE_BINARY_VERSION y TRACE_BLOCKED_VERSION de la cabecera; las trazas de la
+// versión anterior no tienen marcas y una referencia con ese bit las deja como no válidas (es una
+// página reservada, no una escritura). El formato de 32 bits no guarda el proceso ni las
+// escrituras. nextPage devuelve solo la página y nextReference la referencia con su marca.
+#define TRACE_MAGIC "PGTR"
+#define TRACE_HEADER_SIZE 8
+#define TRACE_BLOCKED_HEADER_SIZE 32
+#define TRACE_BINARY_VERSION 1           // Versión de la traza binaria de 64 bits con marcas de escritura (la 0 no las tiene)
+#define TRACE_BLOCKED_VERSION 2          // Versión de la traza comprimida con marcas de escritura (la 1 no las tiene)
+#define TRACE_BLOCK_SIZE (1 << 16)       // Referencias por bloque de las trazas comprimidas que se escriben
+#define TRACE_BUFFER_SIZE (1 << 20)      // Tamaño del búfer de lectura (1 MiB)
+#define TRACE_RELEASE_SIZE (64 << 20)    // Cada cuántos bytes se liberan las páginas ya leídas del mmap
+
+typedef enum TraceFormat {
+    TRACE_TEXT,         // Números de página en texto
+    TRACE_BINARY32,     // Números de página de 32 bits
+    TRACE_BINARY64,     // Números de página de 64 bits
+    TRACE_BLOCKED       // Bloques comprimidos con índice
+} TraceFormat;
+
+// Codificación de un bloque de la traza comprimida
+enum TraceBlockEncoding { TRACE_BLOCK_RAW, TRACE_BLOCK_DELTA };
+
+// Entrada del índice de bloques (16 bytes en el archivo, little-endian)
+typedef struct TraceBlockEntry {
+    uint64_t offset;        // Posición del bloque en el archivo
+    uint32_t count;         // Referencias del bloque
+    uint32_t encoding;      // TRACE_BLOCK_RAW o TRACE_BLOCK_DELTA
+} TraceBlockEntry;
+
+// Estructura para leer una traza de referencias a páginas en memoria constante
+typedef struct TraceReader {
+    int fd;                     // Descriptor del archivo (0 para la entrada estándar)
+    TraceFormat format;         // Formato detectado a partir de la cabecera
+    unsigned char *map;         // Archivo proyectado con mmap (NULL si se lee con read)
+    size_t mapSize;             // Tamaño de la proyección
+    unsigned char *released;    // Hasta dónde ya se liberaron las páginas proyectadas
+    unsigned char *buffer;      // Búfer de lectura cuando no se puede usar mmap
+    unsigned char *pos;         // Siguiente byte por procesar
+    unsigned char *end;         // Fin de los datos disponibles
+    bool eof;                   // Indica si ya no quedan datos por leer del archivo
+    uint64_t count;             // Número de referencias leídas hasta el momento
+    uint64_t total;             // Número de referencias de la traza comprimida
+    const unsigned char *blockIndex; // Índice de bloques de la traza comprimida (dentro del mmap)
+    uint32_t numBlocks;         // Número de bloques de la traza comprimida
+    uint32_t blockSize;         // Referencias por bloque (el último puede tener menos)
+    uint32_t nextBlock;         // Siguiente bloque que lee nextPage
+    uint32_t blockPos;          // Siguiente referencia del bloque actual
+    uint32_t blockCount;        // Referencias del bloque actual
+    const uint64_t *blockPages; // Referencias del bloque actual (en el mmap o en 'decoded')
+    uint64_t *decoded;          // Búfer donde se decodifica un bloque comprimido
+    bool corrupt;               // Indica si la lectura se detuvo en una cabecera, referencia o bloque no válidos
+    bool writeMarks;            // Indica si WRITE_FLAG marca escrituras (si no, una referencia con ese bit no es válida)
+} TraceReader;
+
+// Función para rellenar el búfer conservando los bytes aún no procesados
+static inline bool refillTrace(TraceReader *reader) {
+    if (reader->map != NULL || reader->eof) {
+        return false; // Con mmap todos los datos ya están disponibles
+    }
+
+    size_t pending = (size_t)(reader->end - reader->pos);
+    memmove(reader->buffer, reader->pos, pending);
+    reader->pos = reader->buffer;
+    reader->end = reader->buffer + pending;
+
+    while (reader->end < reader->buffer + TRACE_BUFFER_SIZE) {
+        ssize_t n = read(reader->fd, reader->end, (size_t)(reader->buffer + TRACE_BUFFER_SIZE - reader->end));
+        if (n <= 0) {
+            reader->eof = true;
+            break;
+        }
+        reader->end += n;
+        if ((size_t)(reader->end - reader->buffer) >= 4096) {
+            break; // Suficiente para seguir procesando
+        }
+    }
+    return reader->end > reader->pos;
+}
+
+// Función para asegurar que haya al menos 'bytes' bytes contiguos disponibles
+static inline bool ensureTraceBytes(TraceReader *reader, size_t bytes) {
+    while ((size_t)(reader->end - reader->pos) < bytes) {
+        if (!refillTrace(reader)) {
+            return (size_t)(reader->end - reader->pos) >= bytes;
+        }
+    }
+    return true;
+}
+
+// Función para devolver al sistema las páginas del mmap que ya se procesaron
+static inline void releaseTraceMap(TraceReader *reader) {
+#ifdef MADV_DONTNEED
+    if (reader->map != NULL && reader->pos - reader->released >= TRACE_RELEASE_SIZE) {
+        size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+        size_t length = (size_t)(reader->pos - reader->released) / pageSize * pageSize;
+        madvise(reader->released, length, MADV_DONTNEED);
+        reader->released += length;
+    }
+#else
+    (void)reader;
+#endif
+}
+
+// Función para cerrar la traza y liberar sus recursos
+static inline void closeTrace(TraceReader *reader) {
+    if (reader->map != NULL) {
+        munmap(reader->map, reader->mapSize);
+    }
+    if (reader->fd != 0) {
+        close(reader->fd);
+    }
+    free(reader->buffer);
+    free(reader->decoded);
+    free(reader);
+}
+
+// Función para marcar la traza como no válida e imprimir el motivo; no se lee nada más de ella
+// (devuelve false para que nextReference termine)
+static inline bool corruptTrace(TraceReader *reader, const char *reason) {
+    printf("La traza no es válida en la referencia %llu: %s\n", (unsigned long long)reader->count + 1, reason);
+    reader->corrupt = true;
+    reader->pos = reader->end;
+    reader->eof = true;
+    return false;
+}
+
+// Función para saber si un carácter separa referencias en una traza de texto
+static inline bool isTraceSeparator(int c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+// Función para ver el byte que está 'offset' bytes después de la posición actual sin consumirlo
+// (-1 si la traza termina antes)
+static inline int peekTraceByte(TraceReader *reader, size_t offset) {
+    return ensureTraceBytes(reader, offset + 1) ? reader->pos[offset] : -1;
+}
+
+// Función para leer un número decimal de una traza de texto a partir de un dígito, rellenando el
+// búfer cuando se acaba (un número puede quedar partido entre dos lecturas de un pipe y los ceros
+// a la izquierda lo alargan sin límite); devuelve false si no cabe en 64 bits
+static inline bool parseTraceNumber(TraceReader *reader, uint64_t *value) {
+    uint64_t number = 0;
+    for (int c = peekTraceByte(reader, 0); c >= '0' && c <= '9'; c = peekTraceByte(reader, 0)) {
+        if (__builtin_mul_overflow(number, 10, &number) || __builtin_add_overflow(number, (uint64_t)(c - '0'), &number)) {
+            return false;
+        }
+        reader->pos++;
+    }
+    *value = number;
+    return true;
+}
+
+// Función para leer la entrada del índice de un bloque de la traza comprimida
+static inline TraceBlockEntry traceBlockEntry(const TraceReader *reader, uint32_t block) {
+    TraceBlockEntry entry;
+    memcpy(&entry, reader->blockIndex + (size_t)block * sizeof(TraceBlockEntry), sizeof(entry));
+    return entry;
+}
+
+// Función para validar la cabecera y el índice de una traza comprimida (proyectada con mmap)
+static inline bool openBlockedTrace(TraceReader *reader) {
+    if (reader->map == NULL) {
+        printf("La traza comprimida debe leerse de un archivo regular (no de una tubería)\n");
+        return false;
+    }
+    uint32_t blockSize = 0;
+    uint64_t indexOffset = 0;
+    if (reader->mapSize >= TRACE_BLOCKED_HEADER_SIZE) {
+        memcpy(&blockSize, reader->map + 8, sizeof(blockSize));
+        memcpy(&reader->numBlocks, reader->map + 12, sizeof(reader->numBlocks));
+        memcpy(&reader->total, reader->map + 16, sizeof(reader->total));
+        memcpy(&indexOffset, reader->map + 24, sizeof(indexOffset));
+    }
+    if (reader->mapSize < TRACE_BLOCKED_HEADER_SIZE ||
+        (reader->map[5] != TRACE_BLOCKED_VERSION && reader->map[5] != TRACE_BLOCKED_VERSION - 1) || blockSize == 0 ||
+        indexOffset < TRACE_BLOCKED_HEADER_SIZE || indexOffset > reader->mapSize ||
+        (reader->mapSize - indexOffset) / sizeof(TraceBlockEntry) < reader->numBlocks) {
+        printf("La cabecera de la traza comprimida no es válida\n");
+        return false;
+    }
+    reader->writeMarks = reader->map[5] == TRACE_BLOCKED_VERSION;
+    reader->blockSize = blockSize;
+    reader->blockIndex = reader->map + indexOffset;
+    reader->end = reader->map + indexOffset; // Los bloques terminan donde empieza el índice
+    reader->decoded = (uint64_t *)malloc((size_t)blockSize * sizeof(uint64_t));
+    return reader->decoded != NULL;
+}
+
+// Función para decodificar 'count' referencias codificadas con diferencias en zigzag y varint;
+// devuelve false si los datos terminan antes o un varint es demasiado largo
+static inline bool decodeTraceBlock(const unsigned char *data, const unsigned char *end, uint32_t count, uint64_t *pages) {
+    uint64_t previous = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint64_t value = 0;
+        for (int shift = 0;; shift += 7) {
+            if (data == end || shift > 63) {
+                return false;
+            }
+            unsigned char byte = *data++;
+            value |= (uint64_t)(byte & 0x7F) << shift;
+            if (byte < 0x80) {
+                break;
+            }
+        }
+        previous += (value >> 1) ^ (0 - (value & 1));
+        pages[i] = previous;
+    }
+    return true;
+}
+
+// Función para obtener las referencias de un bloque de la traza comprimida: un bloque sin
+// comprimir se devuelve directamente desde el mmap y uno comprimido se decodifica en 'buffer'
+// (con espacio para blockSize referencias). Devuelve el número de referencias (0 si el bloque
+// no es válido, o si en una traza sin marcas de escritura tiene una referencia con WRITE_FLAG); como
+// solo lee la proyección, varios hilos pueden leer bloques a la vez
+static inline uint32_t readTraceBlock(const TraceReader *reader, uint32_t block, uint64_t *buffer, const uint64_t **pages) {
+    TraceBlockEntry entry = traceBlockEntry(reader, block);
+    size_t available = (size_t)(reader->end - reader->map);
+    if (entry.count == 0 || entry.count > reader->blockSize || entry.offset > available) {
+        return 0;
+    }
+    const unsigned char *data = reader->map + entry.offset;
+    if (entry.encoding == TRACE_BLOCK_RAW) {
+        if (entry.offset % sizeof(uint64_t) != 0 || (available - entry.offset) / sizeof(uint64_t) < entry.count) {
+            return 0;
+        }
+        *pages = (const uint64_t *)(const void *)data;
+    } else if (entry.encoding != TRACE_BLOCK_DELTA || !decodeTraceBlock(data, reader->end, entry.count, buffer)) {
+        return 0;
+    } else {
+        *pages = buffer;
+    }
+    if (!reader->writeMarks) {
+        uint64_t marks = 0;
+        for (uint32_t i = 0; i < entry.count; ++i) {
+            marks |= (*pages)[i];
+        }
+        if (marks & WRITE_FLAG) {
+            return 0;
+        }
+    }
+    return entry.count;
+}
+
+// Función para que nextPage continúe desde el primer acceso de un bloque de la traza comprimida
+static inline void seekTraceBlock(TraceReader *reader, uint32_t block) {
+    reader->nextBlock = block;
+    reader->blockPos = 0;
+    reader->blockCount = 0;
+    reader->count = (uint64_t)block * reader->blockSize;
+}
+
+// Función para abrir una traza ("-" lee de la entrada estándar)
+static inline TraceReader* openTrace(const char *path) {
+    TraceReader *reader = (TraceReader *)calloc(1, sizeof(TraceReader));
+    if (reader == NULL) {
+        return NULL;
+    }
+
+    reader->fd = strcmp(path, "-") == 0 ? 0 : open(path, O_RDONLY);
+    if (reader->fd < 0) {
+        free(reader);
+        return NULL;
+    }
+
+    // Usar mmap para archivos regulares y un búfer grande para tuberías
+    struct stat info;
+    if (fstat(reader->fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+        void *map = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, reader->fd, 0);
+        if (map != MAP_FAILED) {
+#ifdef MADV_SEQUENTIAL
+            madvise(map, (size_t)info.st_size, MADV_SEQUENTIAL);
+#endif
+            reader->map = (unsigned char *)map;
+            reader->mapSize = (size_t)info.st_size;
+            reader->released = reader->map;
+            reader->pos = reader->map;
+            reader->end = reader->map + reader->mapSize;
+            reader->eof = true;
+        }
+    }
+    if (reader->map == NULL) {
+        reader->buffer = (unsigned char *)malloc(TRACE_BUFFER_SIZE);
+        if (reader->buffer == NULL) {
+            if (reader->fd != 0) close(reader->fd);
+            free(reader);
+            return NULL;
+        }
+        reader->pos = reader->buffer;
+        reader->end = reader->buffer;
+    }
+
+    // Detectar el formato a partir de la cabecera
+    reader->format = TRACE_TEXT;
+    if (ensureTraceBytes(reader, TRACE_HEADER_SIZE) && memcmp(reader->pos, TRACE_MAGIC, 4) == 0) {
+        if (reader->pos[4] == 0) {
+            reader->format = TRACE_BLOCKED;
+            if (!openBlockedTrace(reader)) {
+                closeTrace(reader);
+                return NULL;
+            }
+            return reader;
+        }
+        if (reader->pos[4] != 4 && reader->pos[4] != 8) {
+            // No se adivina el ancho: la traza queda sin referencias y marcada como no válida
+            printf("La cabecera de la traza no es válida (ancho de %u bytes)\n", reader->pos[4]);
+            reader->corrupt = true;
+            reader->pos = reader->end;
+            reader->eof = true;
+            return reader;
+        }
+        if (reader->pos[5] != 0 && (reader->pos[4] != 8 || reader->pos[5] != TRACE_BINARY_VERSION)) {
+            printf("La cabecera de la traza no es válida (versión %u)\n", reader->pos[5]);
+            reader->corrupt = true;
+            reader->pos = reader->end;
+            reader->eof = true;
+            return reader;
+        }
+        reader->writeMarks = reader->pos[5] == TRACE_BINARY_VERSION;
+        reader->format = reader->pos[4] == 8 ? TRACE_BINARY64 : TRACE_BINARY32;
+        reader->pos += TRACE_HEADER_SIZE;
+    }
+    return reader;
+}
+
+// Función para leer la siguiente referencia de la traza con su marca de escritura; devuelve false
+// al llegar al final
+static inline bool nextReference(TraceReader *reader, uint64_t *page) {
+    if (reader->format == TRACE_BLOCKED) {
+        if (reader->blockPos == reader->blockCount) {
+            if (reader->nextBlock == reader->numBlocks) {
+                return false;
+            }
+            reader->blockCount = readTraceBlock(reader, reader->nextBlock, reader->decoded, &reader->blockPages);
+            if (reader->blockCount == 0) {
+                printf("El bloque %u de la traza comprimida no es válido\n", reader->nextBlock);
+                reader->nextBlock = reader->numBlocks;
+                reader->corrupt = true;
+                return false;
+            }
+            reader->nextBlock++;
+            reader->blockPos = 0;
+        }
+        *page = reader->blockPages[reader->blockPos++];
+        reader->count++;
+        return true;
+    }
+    if (reader->format == TRACE_BINARY32) {
+        uint32_t value;
+        if (!ensureTraceBytes(reader, sizeof(value))) {
+            return reader->pos == reader->end ? false : corruptTrace(reader, "faltan bytes al final");
+        }
+        memcpy(&value, reader->pos, sizeof(value));
+        reader->pos += sizeof(value);
+        *page = value;
+    } else if (reader->format == TRACE_BINARY64) {
+        if (!ensureTraceBytes(reader, sizeof(*page))) {
+            return reader->pos == reader->end ? false : corruptTrace(reader, "faltan bytes al final");
+        }
+        memcpy(page, reader->pos, sizeof(*page));
+        reader->pos += sizeof(*page);
+        if ((*page & WRITE_FLAG) && !reader->writeMarks) {
+            return corruptTrace(reader, "página con el bit 63 en una traza sin marcas de escritura");
+        }
+    } else {
+        // Saltar separadores y comentarios
+        for (;;) {
+            if (reader->pos == reader->end && !refillTrace(reader)) return false;
+            unsigned char c = *reader->pos;
+            if (c >= '0' && c <= '9') break;
+            if (c == '#') {
+                while (reader->pos < reader->end || refillTrace(reader)) {
+                    if (*reader->pos++ == '\n') break;
+                }
+            } else if (isTraceSeparator(c)) {
+                reader->pos++;
+            } else {
+                return corruptTrace(reader, "carácter inesperado");
+            }
+        }
+
+        uint64_t value;
+        if (!parseTraceNumber(reader, &value)) {
+            return corruptTrace(reader, "número demasiado grande");
+        }
+        if (peekTraceByte(reader, 0) == ':') {
+            uint64_t pid = value;
+            if (pid > MAX_PID) {
+                return corruptTrace(reader, "número de proceso demasiado grande");
+            }
+            reader->pos++;
+            int c = peekTraceByte(reader, 0);
+            if (c < '0' || c > '9') {
+                return corruptTrace(reader, "falta la página después del proceso");
+            }
+            if (!parseTraceNumber(reader, &value)) {
+                return corruptTrace(reader, "número demasiado grande");
+            }
+            if (value >= 1ULL << PID_SHIFT) {
+                return corruptTrace(reader, "la página no cabe en el espacio del proceso");
+            }
+            value = pid << PID_SHIFT | value;
+        } else if (value & WRITE_FLAG) {
+            return corruptTrace(reader, "la página no cabe en 63 bits");
+        }
+
+        // La marca de escritura o lectura puede ir separada por espacios (que se consumen: si no
+        // hay marca también separan la referencia de la siguiente); pegado a la referencia solo
+        // puede venir un separador o el final de la traza
+        bool blank = false;
+        int next = peekTraceByte(reader, 0);
+        while (next == ' ' || next == '\t') {
+            reader->pos++;
+            blank = true;
+            next = peekTraceByte(reader, 0);
+        }
+        if (next == 'W' || next == 'w' || next == 'R' || next == 'r') {
+            value = next == 'W' || next == 'w' ? value | WRITE_FLAG : value & ~WRITE_FLAG;
+            reader->pos++;
+            blank = false;
+            next = peekTraceByte(reader, 0);
+        }
+        if (next >= 0 && !blank && !isTraceSeparator(next)) {
+            return corruptTrace(reader, "carácter inesperado");
+        }
+        *page = value;
+    }
+
+    reader->count++;
+    if ((reader->count & 0xFFFFF) == 0) {
+        releaseTraceMap(reader);
+    }
+    return true;
+}
+
+// Función para leer la página de la siguiente referencia de la traza (sin la marca de escritura)
+static inline bool nextPage(TraceReader *reader, uint64_t *page) {
+    if (!nextReference(reader, page)) {
+        return false;
+    }
+    *page &= ~WRITE_FLAG;
+    return true;
+}
+
+// Estructura para escribir una traza en formato binario, de texto o comprimido por bloques
+typedef struct TraceWriter {
+    FILE *file;             // Archivo de salida
+    TraceFormat format;     // Formato de salida
+    char *buffer;           // Búfer de escritura de stdio (NULL para la salida estándar)
+    uint64_t *block;        // Referencias del bloque en curso (solo comprimido)
+    uint32_t blockCount;    // Referencias en el bloque en curso
+    unsigned char *encoded; // Búfer para codificar un bloque (10 bytes por referencia como máximo)
+    TraceBlockEntry *blocks;// Índice de los bloques ya escritos
+    uint32_t numBlocks;     // Número de bloques escritos
+    uint32_t maxBlocks;     // Capacidad del índice
+    uint64_t offset;        // Bytes escritos hasta el momento
+    uint64_t total;         // Referencias escritas
+    bool failed;            // Indica si faltó memoria para el índice o una referencia no cabía en el formato
+} TraceWriter;
+
+// Función para saber si una referencia (con WRITE_FLAG si es escritura) cabe en un formato: la de
+// 32 bits no guarda el número de proceso ni la marca de escritura
+static inline bool traceFormatFits(TraceFormat format, uint64_t page) {
+    return format != TRACE_BINARY32 || page <= UINT32_MAX;
+}
+
+// Función para crear una traza nueva ("-" escribe en la salida estándar, salvo la comprimida,
+// cuya cabecera se completa al final)
+static inline TraceWriter* createTraceWriter(const char *path, TraceFormat format) {
+    if (format == TRACE_BLOCKED && strcmp(path, "-") == 0) {
+        return NULL;
+    }
+    TraceWriter *writer = (TraceWriter *)calloc(1, sizeof(TraceWriter));
+    if (writer == NULL) {
+        return NULL;
+    }
+    if (format == TRACE_BLOCKED) {
+        writer->block = (uint64_t *)malloc(TRACE_BLOCK_SIZE * sizeof(uint64_t));
+        writer->encoded = (unsigned char *)malloc((size_t)TRACE_BLOCK_SIZE * 10);
+        if (writer->block == NULL || writer->encoded == NULL) {
+            free(writer->block);
+            free(writer->encoded);
+            free(writer);
+            return NULL;
+        }
+    }
+    if (strcmp(path, "-") == 0) {
+        writer->file = stdout;
+    } else {
+        writer->file = fopen(path, "wb");
+        writer->buffer = (char *)malloc(TRACE_BUFFER_SIZE);
+        if (writer->file == NULL || writer->buffer == NULL) {
+            if (writer->file != NULL) fclose(writer->file);
+            free(writer->buffer);
+            free(writer->block);
+            free(writer->encoded);
+            free(writer);
+            return NULL;
+        }
+        setvbuf(writer->file, writer->buffer, _IOFBF, TRACE_BUFFER_SIZE);
+    }
+    writer->format = format;
+
+    if (format == TRACE_BLOCKED) {
+        // Se reserva la cabecera completa; se escribe al cerrar, cuando se conoce el índice
+        unsigned char header[TRACE_BLOCKED_HEADER_SIZE] = {0};
+        fwrite(header, 1, sizeof(header), writer->file);
+        writer->offset = sizeof(header);
+    } else if (format != TRACE_TEXT) {
+        unsigned char header[TRACE_HEADER_SIZE] = {'P', 'G', 'T', 'R', 0, 0, 0, 0};
+        header[4] = format == TRACE_BINARY64 ? 8 : 4;
+        header[5] = format == TRACE_BINARY64 ? TRACE_BINARY_VERSION : 0;
+        fwrite(header, 1, sizeof(header), writer->file);
+    }
+    return writer;
+}
+
+// Función para codificar referencias como diferencias en zigzag y varint; devuelve los bytes usados
+static inline size_t encodeTraceBlock(const uint64_t *pages, uint32_t count, unsigned char *out) {
+    unsigned char *p = out;
+    uint64_t previous = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint64_t delta = pages[i] - previous;
+        uint64_t value = (delta << 1) ^ (0 - (delta >> 63));
+        previous = pages[i];
+        while (value >= 0x80) {
+            *p++ = (unsigned char)(value | 0x80);
+            value >>= 7;
+        }
+        *p++ = (unsigned char)value;
+    }
+    return (size_t)(p - out);
+}
+
+// Función para escribir el bloque en curso de la traza comprimida y agregarlo al índice; si
+// comprimido no ocupa menos se escribe tal cual, alineado a 8 bytes para leerlo sin copiar
+static inline void flushTraceBlock(TraceWriter *writer) {
+    if (writer->blockCount == 0) {
+        return;
+    }
+    if (writer->numBlocks == writer->maxBlocks) {
+        uint32_t grown = writer->maxBlocks > 0 ? 2 * writer->maxBlocks : 64;
+        TraceBlockEntry *blocks = (TraceBlockEntry *)realloc(writer->blocks, grown * sizeof(TraceBlockEntry));
+        if (blocks == NULL) {
+            writer->failed = true;
+            writer->blockCount = 0;
+            return;
+        }
+        writer->blocks = blocks;
+        writer->maxBlocks = grown;
+    }
+    TraceBlockEntry *entry = &writer->blocks[writer->numBlocks++];
+    size_t bytes = encodeTraceBlock(writer->block, writer->blockCount, writer->encoded);
+    size_t raw = (size_t)writer->blockCount * sizeof(uint64_t);
+    if (bytes < raw) {
+        entry->encoding = TRACE_BLOCK_DELTA;
+        fwrite(writer->encoded, 1, bytes, writer->file);
+    } else {
+        static const unsigned char padding[sizeof(uint64_t)] = {0};
+        size_t pad = (size_t)(-writer->offset & (sizeof(uint64_t) - 1));
+        fwrite(padding, 1, pad, writer->file);
+        writer->offset += pad;
+        entry->encoding = TRACE_BLOCK_RAW;
+        fwrite(writer->block, sizeof(uint64_t), writer->blockCount, writer->file);
+        bytes = raw;
+    }
+    entry->offset = writer->offset;
+    entry->count = writer->blockCount;
+    writer->offset += bytes;
+    writer->blockCount = 0;
+}
+
+// Función para agregar una referencia a la traza; si no cabe en el formato no se escribe y la
+// traza queda marcada como fallida
+static inline void writePage(TraceWriter *writer, uint64_t page) {
+    if (!traceFormatFits(writer->format, page)) {
+        writer->failed = true;
+    } else if (writer->format == TRACE_BLOCKED) {
+        writer->block[writer->blockCount++] = page;
+        writer->total++;
+        if (writer->blockCount == TRACE_BLOCK_SIZE) {
+            flushTraceBlock(writer);
+        }
+    } else if (writer->format == TRACE_BINARY32) {
+        uint32_t value = (uint32_t)page;
+        fwrite(&value, sizeof(value), 1, writer->file);
+    } else if (writer->format == TRACE_BINARY64) {
+        fwrite(&page, sizeof(page), 1, writer->file);
+    } else {
+        uint64_t pid = (page & ~WRITE_FLAG) >> PID_SHIFT;
+        if (pid != 0) {
+            fprintf(writer->file, "%llu:", (unsigned long long)pid);
+        }
+        fprintf(writer->file, "%llu%s\n", (unsigned long long)(page & ((1ULL << PID_SHIFT) - 1)),
+                page & WRITE_FLAG ? " W" : "");
+    }
+}
+
+// Función para terminar una traza comprimida: último bloque, índice y cabecera
+static inline void finishBlockedTrace(TraceWriter *writer) {
+    flushTraceBlock(writer);
+    fwrite(writer->blocks, sizeof(TraceBlockEntry), writer->numBlocks, writer->file);
+
+    unsigned char header[TRACE_BLOCKED_HEADER_SIZE] = {'P', 'G', 'T', 'R', 0, TRACE_BLOCKED_VERSION, 0, 0};
+    uint32_t blockSize = TRACE_BLOCK_SIZE;
+    memcpy(header + 8, &blockSize, sizeof(blockSize));
+    memcpy(header + 12, &writer->numBlocks, sizeof(writer->numBlocks));
+    memcpy(header + 16, &writer->total, sizeof(writer->total));
+    memcpy(header + 24, &writer->offset, sizeof(writer->offset));
+    if (fseek(writer->file, 0, SEEK_SET) != 0) {
+        writer->failed = true;
+        return;
+    }
+    fwrite(header, 1, sizeof(header), writer->file);
+}
+
+// Función para cerrar la traza escrita; devuelve false si hubo un error de escritura
+static inline bool closeTraceWriter(TraceWriter *writer) {
+    if (writer->format == TRACE_BLOCKED) {
+        finishBlockedTrace(writer);
+    }
+    bool ok = fflush(writer->file) == 0 && !ferror(writer->file) && !writer->failed;
+    if (writer->file != stdout) {
+        ok = fclose(writer->file) == 0 && ok;
+    }
+    free(writer->buffer);
+    free(writer->block);
+    free(writer->encoded);
+    free(writer->blocks);
+    free(writer);
+    return ok;
+}
+
+// Función para leer un número de frames (de 1 a MAX_FRAMES) que termina en 'stop' o al final del
+// texto; devuelve false si no es un número válido
+static inline bool parseFrameCount(const char *text, char stop, int *frames) {
+    char *end;
+    long value = strtol(text, &end, 10);
+    if (end == text || (*end != stop && *end != '\0') || value < 1 || value > MAX_FRAMES) {
+        return false;
+    }
+    *frames = (int)value;
+    return true;
+}
+
+// Función para leer los argumentos comunes de los simuladores: [-f frames] [traza]
+// Deja 'frames' y 'path' sin cambios si no se indican; devuelve false si los argumentos no son válidos
+static inline bool parseTraceArgs(int argc, char *argv[], int *frames, const char **path) {
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            if (!parseFrameCount(argv[++i], '\0', frames)) {
+                printf("Número de frames no válido: %s\n", argv[i]);
+                return false;
+            }
+        } else if (*path == NULL && (argv[i][0] != '-' || argv[i][1] == '\0')) {
+            *path = argv[i];
+        } else {
+            printf("Uso: %s [-f frames] [traza]\n", argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Función para imprimir el resumen de una simulación sobre una traza
+static inline void printTraceSummary(uint64_t accesses, uint64_t hits) {
+    printf("Accesos: %llu\n", (unsigned long long)accesses);
+    printf("Aciertos: %llu (%.2f%%)\n", (unsigned long long)hits,
+           accesses > 0 ? 100.0 * hits / accesses : 0.0);
+    printf("Fallos de página: %llu (%.2f%%)\n", (unsigned long long)(accesses - hits),
+           accesses > 0 ? 100.0 * (accesses - hits) / accesses : 0.0);
+}
+
+#endif
@@ -0,0 +1,295 @@
+#ifndef VM_MODEL_H
+#define VM_MODEL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "POLICY.h"
+#include "PAGE_INDEX.h"
+
+// Modelo de memoria virtual alrededor de una política de reemplazo: cada referencia (lectura o
+// escritura, ver WRITE_FLAG) pasa primero por un TLB asociativo por conjuntos y, si falla, por un
+// recorrido de la tabla de páginas de varios niveles; la política decide qué páginas están en
+// memoria. La tabla guarda en cada entrada los bits de presente y sucio: una escritura ensucia la
+// página y, cuando la política la expulsa, se cuenta una escritura a disco (si no, la expulsión es
+// limpia) y su entrada del TLB se invalida.
+// La tabla de páginas es un árbol de 'levels' niveles de VM_TABLE_ENTRIES entradas (9 bits de la
+// página por nivel, como x86-64); los bits de la página por encima de los niveles (el proceso, en
+// una traza etiquetada) eligen la raíz con un índice, como si cada región tuviera su propia tabla.
+// Cada nodo cuenta como una página de tabla de 4 KiB, aunque las hojas solo guardan un byte por
+// entrada. El TLB tiene su propio reemplazo dentro de cada conjunto: LRU, FIFO o aleatorio.
+// El modelo de latencias convierte los contadores en un tiempo medio por acceso:
+//   TLB + memoria por cada acceso, + niveles * memoria por cada fallo del TLB,
+//   + fallo por cada fallo de página y + escritura por cada página sucia expulsada
+
+#define VM_LEVEL_BITS 9                        // Bits de la página por nivel de la tabla
+#define VM_TABLE_ENTRIES (1 << VM_LEVEL_BITS)  // Entradas por nodo de la tabla
+#define VM_MAX_LEVELS 6                        // Niveles como máximo (54 bits de página)
+#define VM_TABLE_PAGE 4096                     // Bytes que se cuentan por cada nodo de la tabla
+#define VM_TLB_MAX_WAYS 64                     // Vías como máximo por conjunto del TLB
+
+#define PTE_PRESENT 1   // La página está en memoria
+#define PTE_DIRTY 2     // La página se escribió desde que se cargó
+
+enum TlbReplacement { TLB_LRU, TLB_FIFO, TLB_RANDOM };
+
+static const char *const tlbReplacementNames[] = {"lru", "fifo", "random"};
+
+// Tabla de páginas de varios niveles
+typedef struct PageTable {
+    int levels;                 // Niveles del árbol
+    PageIndex *roots;           // Bits altos de la página -> raíz (posición en 'nodes')
+    void **nodes;               // Todos los nodos (para liberarlos y contarlos)
+    uint64_t numNodes;
+    uint64_t maxNodes;
+} PageTable;
+
+// TLB asociativo por conjuntos
+typedef struct Tlb {
+    int sets;                   // Número de conjuntos (potencia de dos)
+    int ways;                   // Entradas por conjunto
+    int replacement;            // TLB_LRU, TLB_FIFO o TLB_RANDOM
+    PageId *tags;               // Página de cada entrada (NO_PAGE si está libre), sets * ways
+    uint64_t *stamps;           // Último uso (LRU) o momento de carga (FIFO) de cada entrada
+    uint64_t clock;             // Número de búsquedas
+    uint64_t random;            // Estado del generador pseudoaleatorio (TLB_RANDOM)
+} Tlb;
+
+// Latencias en nanosegundos
+typedef struct LatencyModel {
+    double tlb;                 // Búsqueda en el TLB
+    double memory;              // Un acceso a memoria (el dato o un nivel de la tabla)
+    double fault;               // Atender un fallo de página (leer la página del disco)
+    double writeBack;           // Escribir en el disco una página sucia expulsada
+} LatencyModel;
+
+// Modelo de memoria virtual de una política
+typedef struct VmModel {
+    Policy *policy;             // Política de reemplazo de páginas
+    PageTable table;            // Tabla de páginas
+    Tlb tlb;                    // TLB
+    uint64_t reads;             // Lecturas
+    uint64_t writes;            // Escrituras
+    uint64_t tlbMisses;         // Fallos del TLB (cada uno es un recorrido de la tabla)
+    uint64_t writeBacks;        // Páginas sucias expulsadas (escrituras a disco)
+    uint64_t cleanEvictions;    // Páginas limpias expulsadas
+} VmModel;
+
+// Función para leer el modelo de latencias "tlb=1,mem=100,fault=100000,wb=100000" (las claves
+// que no aparecen conservan su valor); devuelve false si no es válido
+static inline bool parseLatencyModel(const char *text, LatencyModel *latency) {
+    static const char *const keys[] = {"tlb=", "mem=", "fault=", "wb="};
+    double *values[] = {&latency->tlb, &latency->memory, &latency->fault, &latency->writeBack};
+    const char *c = text;
+    while (*c != '\0') {
+        int k = 0;
+        while (k < 4 && strncmp(c, keys[k], strlen(keys[k])) != 0) {
+            k++;
+        }
+        if (k == 4) {
+            return false;
+        }
+        c += strlen(keys[k]);
+        char *end;
+        double value = strtod(c, &end);
+        if (end == c || value < 0.0 || (*end != ',' && *end != '\0')) {
+            return false;
+        }
+        *values[k] = value;
+        c = *end == ',' ? end + 1 : end;
+    }
+    return true;
+}
+
+// Función para agregar un nodo vacío a la tabla; devuelve su posición o UINT64_MAX sin memoria
+static inline uint64_t createTableNode(PageTable *table, bool leaf) {
+    if (table->numNodes == table->maxNodes) {
+        uint64_t maxNodes = table->maxNodes > 0 ? 2 * table->maxNodes : 64;
+        void **nodes = (void **)realloc(table->nodes, maxNodes * sizeof(void *));
+        if (nodes == NULL) {
+            return UINT64_MAX;
+        }
+        table->nodes = nodes;
+        table->maxNodes = maxNodes;
+    }
+    void *node = leaf ? calloc(VM_TABLE_ENTRIES, sizeof(uint8_t)) : calloc(VM_TABLE_ENTRIES, sizeof(void *));
+    if (node == NULL) {
+        return UINT64_MAX;
+    }
+    table->nodes[table->numNodes] = node;
+    return table->numNodes++;
+}
+
+// Función para obtener la entrada de una página en la tabla; con 'create' se crean los nodos que
+// falten (devuelve NULL si no hay memoria) y sin él devuelve NULL si la página no tiene entrada
+static inline uint8_t* pageTableEntry(PageTable *table, PageId page, bool create) {
+    int shift = VM_LEVEL_BITS * table->levels;
+    PageId top = (PageId)((uint64_t)page >> shift);
+    uint64_t *root = indexFind(table->roots, top);
+    uint64_t position;
+    if (root != NULL) {
+        position = *root;
+    } else {
+        if (!create || (position = createTableNode(table, table->levels == 1)) == UINT64_MAX ||
+            !indexInsert(table->roots, top, position)) {
+            return NULL;
+        }
+    }
+    void *node = table->nodes[position];
+    for (int level = table->levels - 1; level > 0; --level) {
+        uint64_t slot = ((uint64_t)page >> (VM_LEVEL_BITS * level)) & (VM_TABLE_ENTRIES - 1);
+        void **children = (void **)node;
+        if (children[slot] == NULL) {
+            if (!create || (position = createTableNode(table, level == 1)) == UINT64_MAX) {
+                return NULL;
+            }
+            children[slot] = table->nodes[position];
+        }
+        node = children[slot];
+    }
+    return (uint8_t *)node + ((uint64_t)page & (VM_TABLE_ENTRIES - 1));
+}
+
+// Función para buscar una página en el TLB; en un fallo la carga reemplazando una entrada del
+// conjunto según el reemplazo del TLB. Devuelve true si hubo acierto
+static inline bool tlbLookup(Tlb *tlb, PageId page) {
+    uint64_t set = hashPage(page) & (uint64_t)(tlb->sets - 1);
+    PageId *tags = tlb->tags + set * (uint64_t)tlb->ways;
+    uint64_t *stamps = tlb->stamps + set * (uint64_t)tlb->ways;
+    uint64_t now = ++tlb->clock;
+    int victim = 0;
+    for (int way = 0; way < tlb->ways; ++way) {
+        if (tags[way] == page) {
+            if (tlb->replacement == TLB_LRU) {
+                stamps[way] = now;
+            }
+            return true;
+        }
+        if (tags[victim] != NO_PAGE && (tags[way] == NO_PAGE || stamps[way] < stamps[victim])) {
+            victim = way;
+        }
+    }
+    if (tlb->replacement == TLB_RANDOM && tags[victim] != NO_PAGE) {
+        victim = (int)(((nextRandom(&tlb->random) >> 32) * (uint64_t)tlb->ways) >> 32);
+    }
+    tags[victim] = page;
+    stamps[victim] = now;
+    return false;
+}
+
+// Función para invalidar la entrada de una página en el TLB (si está)
+static inline void tlbInvalidate(Tlb *tlb, PageId page) {
+    uint64_t set = hashPage(page) & (uint64_t)(tlb->sets - 1);
+    PageId *tags = tlb->tags + set * (uint64_t)tlb->ways;
+    for (int way = 0; way < tlb->ways; ++way) {
+        if (tags[way] == page) {
+            tags[way] = NO_PAGE;
+        }
+    }
+}
+
+// Función para liberar un modelo de memoria virtual
+static inline void destroyVmModel(VmModel *vm) {
+    if (vm == NULL) {
+        return;
+    }
+    destroyPolicy(vm->policy);
+    for (uint64_t i = 0; i < vm->table.numNodes; ++i) {
+        free(vm->table.nodes[i]);
+    }
+    free(vm->table.nodes);
+    destroyPageIndex(vm->table.roots);
+    free(vm->tlb.tags);
+    free(vm->tlb.stamps);
+    free(vm);
+}
+
+// Función para crear el modelo de memoria virtual de una política con 'capacity' frames, una tabla
+// de 'levels' niveles y un TLB de 'sets' conjuntos (potencia de dos) de 'ways' vías
+static inline VmModel* createVmModel(const PolicyOps *ops, int capacity, int levels, int sets, int ways, int replacement) {
+    VmModel *vm = (VmModel *)calloc(1, sizeof(VmModel));
+    if (vm == NULL) {
+        return NULL;
+    }
+    vm->policy = createPolicy(ops, capacity);
+    vm->table.levels = levels;
+    vm->table.roots = createPageIndex(16);
+    vm->tlb.sets = sets;
+    vm->tlb.ways = ways;
+    vm->tlb.replacement = replacement;
+    vm->tlb.random = 0x9E3779B97F4A7C15ULL;
+    vm->tlb.tags = (PageId *)malloc((size_t)sets * ways * sizeof(PageId));
+    vm->tlb.stamps = (uint64_t *)calloc((size_t)sets * ways, sizeof(uint64_t));
+    if (vm->policy == NULL || vm->table.roots == NULL || vm->tlb.tags == NULL || vm->tlb.stamps == NULL) {
+        destroyVmModel(vm);
+        return NULL;
+    }
+    for (int i = 0; i < sets * ways; ++i) {
+        vm->tlb.tags[i] = NO_PAGE;
+    }
+    return vm;
+}
+
+// Función para simular una referencia (con su marca de escritura); devuelve false si no hay memoria
+static inline bool vmAccess(VmModel *vm, uint64_t reference, uint64_t nextUse) {
+    PageId page = referencePage(reference);
+    bool write = (reference & WRITE_FLAG) != 0;
+    if (write) {
+        vm->writes++;
+    } else {
+        vm->reads++;
+    }
+    if (!tlbLookup(&vm->tlb, page)) {
+        vm->tlbMisses++;
+    }
+    uint8_t *entry = pageTableEntry(&vm->table, page, true);
+    if (entry == NULL) {
+        return false;
+    }
+    PageId victim;
+    if (!policyAccess(vm->policy, page, nextUse, &victim)) {
+        *entry |= PTE_PRESENT;
+        if (victim != NO_PAGE) {
+            uint8_t *evicted = pageTableEntry(&vm->table, victim, false);
+            if (*evicted & PTE_DIRTY) {
+                vm->writeBacks++;
+            } else {
+                vm->cleanEvictions++;
+            }
+            *evicted = 0;
+            tlbInvalidate(&vm->tlb, victim);
+        }
+    }
+    if (write) {
+        *entry |= PTE_DIRTY;
+    }
+    return true;
+}
+
+// Función para estimar el tiempo total de las referencias simuladas (en nanosegundos)
+static inline double vmEstimatedTime(const VmModel *vm, const LatencyModel *latency) {
+    uint64_t accesses = vm->reads + vm->writes;
+    return accesses * (latency->tlb + latency->memory) + vm->tlbMisses * vm->table.levels * latency->memory +
+           vm->policy->stats.misses * latency->fault + vm->writeBacks * latency->writeBack;
+}
+
+// Función para imprimir el encabezado de la tabla de resultados del modelo de memoria virtual
+static inline void printVmHeader() {
+    printf("%-10s %8s %9s %11s %11s %9s %8s %13s\n", "Política", "Frames", "Fallos%", "Escrituras", "Limpias",
+           "TLB%", "Tabla", "ns/acceso");
+}
+
+// Función para imprimir una fila: fallos de página, expulsiones sucias (escrituras a disco) y
+// limpias, fallos del TLB, páginas de la tabla y tiempo medio estimado por acceso
+static inline void printVmModel(const VmModel *vm, const LatencyModel *latency) {
+    uint64_t accesses = vm->reads + vm->writes;
+    double perAccess = accesses > 0 ? vm->policy->stats.misses * 100.0 / accesses : 0.0;
+    printf("%-10s %8d %8.2f%% %11llu %11llu %8.2f%% %8llu %13.1f\n", vm->policy->ops->name, vm->policy->capacity,
+           perAccess, (unsigned long long)vm->writeBacks, (unsigned long long)vm->cleanEvictions,
+           accesses > 0 ? 100.0 * vm->tlbMisses / accesses : 0.0, (unsigned long long)vm->table.numNodes,
+           accesses > 0 ? vmEstimatedTime(vm, latency) / accesses : 0.0);
+}
+
+#endif
@@ -0,0 +1,654 @@
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include "FRAME_LIST.h"
+
+// Generadores de trazas sintéticas para comparar políticas con patrones de acceso conocidos
+// (Zipf usa funciones de <math.h>: compilar con -lm)
+
+// Generador pseudoaleatorio xoshiro256** (rápido y con buena calidad estadística)
+typedef struct WorkloadRng {
+    uint64_t s[4];
+} WorkloadRng;
+
+// Función para rotar a la izquierda un entero de 64 bits
+static inline uint64_t rotateLeft(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+// Función para inicializar el generador a partir de una semilla (expandida con splitmix64)
+static inline void seedWorkloadRng(WorkloadRng *rng, uint64_t seed) {
+    for (int i = 0; i < 4; ++i) {
+        uint64_t z = (seed += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        rng->s[i] = z ^ (z >> 31);
+    }
+}
+
+// Función para obtener el siguiente número pseudoaleatorio de 64 bits
+static inline uint64_t workloadNext(WorkloadRng *rng) {
+    uint64_t result = rotateLeft(rng->s[1] * 5, 7) * 9;
+    uint64_t t = rng->s[1] << 17;
+    rng->s[2] ^= rng->s[0];
+    rng->s[3] ^= rng->s[1];
+    rng->s[1] ^= rng->s[2];
+    rng->s[0] ^= rng->s[3];
+    rng->s[2] ^= t;
+    rng->s[3] = rotateLeft(rng->s[3], 45);
+    return result;
+}
+
+// Función para elegir un entero uniforme en [0, n)
+static inline uint64_t workloadUniform(WorkloadRng *rng, uint64_t n) {
+    return (uint64_t)(((unsigned __int128)workloadNext(rng) * n) >> 64);
+}
+
+// Función para obtener un número uniforme en [0, 1)
+static inline double workloadUniform01(WorkloadRng *rng) {
+    return (double)(workloadNext(rng) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Distribución de Zipf sobre los rangos 1..n con exponente s, muestreada en O(1) por
+// rechazo-inversión (Hörmann y Derflinger), sin tablas de tamaño n
+typedef struct ZipfSampler {
+    uint64_t n;             // Número de elementos
+    double exponent;        // Exponente s (> 0)
+    double hIntegralX1;     // H(1.5) - 1
+    double hIntegralN;      // H(n + 0.5)
+    double threshold;       // Cota para aceptar sin evaluar H (2 - Hinv(H(2.5) - h(2)))
+} ZipfSampler;
+
+// Función auxiliar log(1 + x) / x, estable cerca de 0
+static inline double zipfHelper1(double x) {
+    return fabs(x) > 1e-8 ? log1p(x) / x : 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+}
+
+// Función auxiliar (exp(x) - 1) / x, estable cerca de 0
+static inline double zipfHelper2(double x) {
+    return fabs(x) > 1e-8 ? expm1(x) / x : 1.0 + x * 0.5 * (1.0 + x * (1.0 / 3.0) * (1.0 + 0.25 * x));
+}
+
+// Función h(x) = x^-s
+static inline double zipfH(const ZipfSampler *z, double x) {
+    return exp(-z->exponent * log(x));
+}
+
+// Función H(x), integral de h
+static inline double zipfHIntegral(const ZipfSampler *z, double x) {
+    double logX = log(x);
+    return zipfHelper2((1.0 - z->exponent) * logX) * logX;
+}
+
+// Función inversa de H
+static inline double zipfHIntegralInverse(const ZipfSampler *z, double x) {
+    double t = x * (1.0 - z->exponent);
+    if (t < -1.0) {
+        t = -1.0;
+    }
+    return exp(zipfHelper1(t) * x);
+}
+
+// Función para preparar el muestreo de Zipf sobre 1..n con exponente s
+static inline void initZipf(ZipfSampler *z, uint64_t n, double exponent) {
+    z->n = n;
+    z->exponent = exponent;
+    z->hIntegralX1 = zipfHIntegral(z, 1.5) - 1.0;
+    z->hIntegralN = zipfHIntegral(z, (double)n + 0.5);
+    z->threshold = 2.0 - zipfHIntegralInverse(z, zipfHIntegral(z, 2.5) - zipfH(z, 2.0));
+}
+
+// Función para obtener un rango de Zipf en [0, n) (0 es el más frecuente)
+static inline uint64_t zipfNext(const ZipfSampler *z, WorkloadRng *rng) {
+    for (;;) {
+        double u = z->hIntegralN + workloadUniform01(rng) * (z->hIntegralX1 - z->hIntegralN);
+        double x = zipfHIntegralInverse(z, u);
+        double k = floor(x + 0.5);
+        if (k < 1.0) {
+            k = 1.0;
+        } else if (k > (double)z->n) {
+            k = (double)z->n;
+        }
+        if (k - x <= z->threshold || u >= zipfHIntegral(z, k + 0.5) - zipfH(z, k)) {
+            return (uint64_t)k - 1;
+        }
+    }
+}
+
+// Función para generar accesos de Zipf sobre las páginas base..base+pages-1
+static inline void generateZipf(PageId *trace, uint32_t count, uint64_t pages, double exponent, PageId base, WorkloadRng *rng) {
+    ZipfSampler z;
+    initZipf(&z, pages, exponent);
+    for (uint32_t t = 0; t < count; ++t) {
+        trace[t] = base + (PageId)zipfNext(&z, rng);
+    }
+}
+
+// Función para generar un ciclo: base, base+1, ..., base+pages-1, base, ... hasta 'count' accesos
+static inline void generateLoop(PageId *trace, uint32_t count, uint64_t pages, PageId base) {
+    for (uint32_t t = 0; t < count; ++t) {
+        trace[t] = base + (PageId)(t % pages);
+    }
+}
+
+// Función para generar un recorrido secuencial de 'count' páginas a partir de *next (que avanza)
+static inline void generateScan(PageId *trace, uint32_t count, PageId *next) {
+    for (uint32_t t = 0; t < count; ++t) {
+        trace[t] = (*next)++;
+    }
+}
+
+// Función para generar una traza mixta para una memoria de 'frames' frames que repite cuatro fases:
+// Zipf (s = 1) sobre 8 * frames páginas, un ciclo sobre 5/4 * frames páginas, otra vez Zipf y
+// un recorrido de 2 * frames páginas nuevas
+static inline void generateMixed(PageId *trace, uint32_t count, uint64_t frames, uint64_t seed) {
+    WorkloadRng rng;
+    seedWorkloadRng(&rng, seed);
+    uint64_t zipfPages = 8 * frames;
+    uint64_t loopPages = frames + frames / 4;
+    PageId loopBase = (PageId)zipfPages;
+    PageId nextScanPage = loopBase + (PageId)loopPages;
+    uint32_t t = 0;
+    for (int phase = 0; t < count; phase = (phase + 1) % 4) {
+        uint32_t length = phase == 1 ? (uint32_t)(3 * loopPages) : phase == 3 ? (uint32_t)(2 * frames) : (uint32_t)(4 * frames);
+        if (length > count - t) {
+            length = count - t;
+        }
+        if (phase == 0 || phase == 2) {
+            generateZipf(trace + t, length, zipfPages, 1.0, 0, &rng);
+        } else if (phase == 1) {
+            generateLoop(trace + t, length, loopPages, loopBase);
+        } else {
+            generateScan(trace + t, length, &nextScanPage);
+        }
+        t += length;
+    }
+}
+
+// Función para generar una traza con un conjunto caliente contaminado por recorridos secuenciales:
+// 'scanEvery' accesos uniformes a las páginas 0..hotPages-1 seguidos de un recorrido de
+// 'scanLength' páginas nuevas que no se vuelven a usar, repetido hasta completar 'count' accesos
+static inline void generateScanPolluted(PageId *trace, uint32_t count, uint64_t hotPages, uint64_t scanLength,
+                                        uint64_t scanEvery, uint64_t seed) {
+    WorkloadRng rng;
+    seedWorkloadRng(&rng, seed);
+    PageId nextScanPage = (PageId)hotPages;
+    uint32_t t = 0;
+    while (t < count) {
+        for (uint64_t i = 0; i < scanEvery && t < count; ++i) {
+            trace[t++] = (PageId)workloadUniform(&rng, hotPages);
+        }
+        for (uint64_t i = 0; i < scanLength && t < count; ++i) {
+            trace[t++] = nextScanPage++;
+        }
+    }
+}
+
+// Generador de cargas de trabajo descritas con una especificación de texto (modo --generate y -w
+// del simulador). Una carga es una lista de fases que se repite hasta completar la traza; cada
+// fase es una mezcla de fuentes y cada acceso sale de una fuente elegida al azar según su peso:
+//   carga  := fase (';' fase)*
+//   fase   := mezcla ['/' accesos]          (sin largo la fase dura toda la traza; admite k y M)
+//   mezcla := [peso '*'] fuente ('+' [peso '*'] fuente)*
+//   fuente := uniform:N | zipf:N[:s] | loop:N | scan     seguida opcionalmente de '@' base, '#' proceso
+//             y '!' fracción de escrituras
+// uniform elige entre N páginas, zipf usa rangos de Zipf con exponente s (por defecto 1), loop
+// recorre N páginas en ciclo y scan avanza por páginas nuevas que no se repiten. Las páginas de
+// una fuente son base..base+N-1 (base 0 por defecto; los recorridos empiezan en WORKLOAD_SCAN_BASE
+// para no chocar con las demás). Cada fuente conserva su posición entre repeticiones de la fase,
+// y dos fases con bases distintas modelan un cambio del conjunto de trabajo. Con '#' proceso las
+// páginas llevan el número de proceso en los bits altos (ver PID_SHIFT), así una mezcla modela
+// varios procesos intercalados. Con '!' fracción (entre 0 y 1) esa parte de los accesos de la fuente
+// son escrituras, marcadas con WRITE_FLAG solo si la carga se crea con keepWrites (el resto de los
+// modos solo ven páginas). Ejemplos:
+//   "zipf:1M:0.99"                         Zipf sobre un millón de páginas
+//   "0.9*zipf:64k+0.1*scan"                conjunto caliente contaminado por recorridos
+//   "uniform:4k/1M;uniform:4k@4k/1M"       el conjunto de trabajo cambia cada millón de accesos
+//   "0.5*zipf:4k#1+0.5*loop:1k#2"          dos procesos intercalados
+//   "zipf:64k!0.3"                         Zipf con 30% de escrituras
+// Con la misma especificación y la misma semilla la traza es siempre la misma.
+// Los números aleatorios no salen de xoshiro sino de dispersar el número de acceso con la mezcla
+// de splitmix64: no hay una cadena de dependencias entre accesos consecutivos, así el procesador
+// calcula varios a la vez (xoshiro limita a ~300 millones por segundo). Zipf usa una tabla de
+// alias (Walker) de 8 bytes por página, así cada acceso cuesta un número aleatorio y una lectura;
+// con más de WORKLOAD_ALIAS_MAX páginas usa el muestreo por rechazo con xoshiro.
+
+#define WORKLOAD_MAX_PHASES 16            // Fases como máximo
+#define WORKLOAD_MAX_SOURCES 8            // Fuentes como máximo por fase
+#define WORKLOAD_ALIAS_MAX (1ULL << 24)   // Páginas como máximo de una tabla de alias de Zipf
+#define WORKLOAD_SCAN_BASE (1LL << 40)    // Primera página de los recorridos si no se indica la base
+
+enum WorkloadKind { WORKLOAD_UNIFORM, WORKLOAD_ZIPF, WORKLOAD_LOOP, WORKLOAD_SCAN };
+
+// Entrada de la tabla de alias: el rango i sale si los 32 bits bajos del número aleatorio son
+// menores que 'threshold' y si no sale 'alias'
+typedef struct ZipfAliasEntry {
+    uint32_t threshold;
+    uint32_t alias;
+} ZipfAliasEntry;
+
+// Fuente de referencias de una fase
+typedef struct WorkloadSource {
+    int kind;                   // WORKLOAD_UNIFORM, WORKLOAD_ZIPF, WORKLOAD_LOOP o WORKLOAD_SCAN
+    uint64_t pages;             // Número de páginas (no se usa en los recorridos)
+    double exponent;            // Exponente de Zipf
+    PageId base;                // Primera página
+    uint64_t position;          // Siguiente posición del ciclo o del recorrido
+    uint64_t weight;            // Probabilidad acumulada hasta esta fuente (escala 2^64, la última es el máximo)
+    ZipfAliasEntry *alias;      // Tabla de alias de Zipf (NULL si se usa 'zipf')
+    ZipfSampler zipf;           // Muestreo por rechazo para Zipf muy grandes
+    uint64_t writes;            // Probabilidad de escritura (escala 2^64; 0 = solo lecturas)
+} WorkloadSource;
+
+// Fase de la carga de trabajo
+typedef struct WorkloadPhase {
+    WorkloadSource sources[WORKLOAD_MAX_SOURCES];
+    int numSources;
+    uint64_t length;            // Accesos de la fase (0 = hasta el final de la traza)
+} WorkloadPhase;
+
+// Carga de trabajo con su posición actual
+typedef struct Workload {
+    WorkloadPhase phases[WORKLOAD_MAX_PHASES];
+    int numPhases;
+    int phase;                  // Fase actual
+    uint64_t remaining;         // Accesos que le quedan a la fase actual
+    uint64_t position;          // Número del siguiente acceso
+    uint64_t key;               // Semilla dispersada (los números aleatorios son hash(key, acceso))
+    WorkloadRng rng;            // Generador para el muestreo por rechazo de Zipf
+    bool keepWrites;            // Marcar las escrituras con WRITE_FLAG
+} Workload;
+
+// Función para obtener el número aleatorio 'index' de la secuencia 'key' (mezcla de splitmix64)
+static inline uint64_t workloadHash(uint64_t key, uint64_t index) {
+    uint64_t z = key + index * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Función para elegir un rango con la tabla de alias a partir de un número aleatorio de 64 bits
+// (sin saltos: el resultado se elige con una máscara)
+static inline uint64_t zipfAliasRank(const ZipfAliasEntry *alias, uint64_t pages, uint64_t r) {
+    uint32_t rank = (uint32_t)(((r >> 32) * pages) >> 32);
+    ZipfAliasEntry entry = alias[rank];
+    uint32_t keep = 0 - (uint32_t)((uint32_t)r < entry.threshold);
+    return (rank & keep) | (entry.alias & ~keep);
+}
+
+// Función para construir la tabla de alias de Zipf sobre n rangos (algoritmo de Vose)
+static inline ZipfAliasEntry* createZipfAlias(uint64_t n, double exponent) {
+    ZipfAliasEntry *table = (ZipfAliasEntry *)malloc(n * sizeof(ZipfAliasEntry));
+    double *probability = (double *)malloc(n * sizeof(double));
+    uint32_t *work = (uint32_t *)malloc(n * sizeof(uint32_t));
+    if (table == NULL || probability == NULL || work == NULL) {
+        free(table);
+        free(probability);
+        free(work);
+        return NULL;
+    }
+    double sum = 0.0;
+    for (uint64_t i = 0; i < n; ++i) {
+        probability[i] = exp(-exponent * log((double)(i + 1)));
+        sum += probability[i];
+    }
+    // 'work' guarda las pequeñas (< 1) desde el principio y las grandes desde el final
+    uint64_t small = 0, large = n;
+    for (uint64_t i = 0; i < n; ++i) {
+        probability[i] *= (double)n / sum;
+        if (probability[i] < 1.0) {
+            work[small++] = (uint32_t)i;
+        } else {
+            work[--large] = (uint32_t)i;
+        }
+    }
+    while (small > 0 && large < n) {
+        uint32_t less = work[--small];
+        uint32_t more = work[large];
+        table[less].threshold = (uint32_t)(probability[less] * 4294967296.0);
+        table[less].alias = more;
+        probability[more] -= 1.0 - probability[less];
+        if (probability[more] < 1.0) {
+            large++;
+            work[small++] = more;
+        }
+    }
+    // Las que quedan valen 1 (salvo errores de redondeo): siempre salen ellas mismas
+    while (small > 0) {
+        uint32_t i = work[--small];
+        table[i].threshold = UINT32_MAX;
+        table[i].alias = i;
+    }
+    for (; large < n; ++large) {
+        table[work[large]].threshold = UINT32_MAX;
+        table[work[large]].alias = work[large];
+    }
+    free(probability);
+    free(work);
+    return table;
+}
+
+// Función para leer un número con sufijo opcional k (×1024) o M (×1048576); devuelve false si no
+// empieza con un dígito (strtoull aceptaría espacios y signo) o si no cabe en 64 bits
+static inline bool parseWorkloadCount(const char **text, uint64_t *value) {
+    char *end;
+    if (**text < '0' || **text > '9') {
+        return false;
+    }
+    errno = 0;
+    *value = strtoull(*text, &end, 10);
+    if (errno == ERANGE) {
+        return false;
+    }
+    int shift = 0;
+    if (*end == 'k' || *end == 'K') {
+        shift = 10;
+        end++;
+    } else if (*end == 'M') {
+        shift = 20;
+        end++;
+    }
+    if (*value > UINT64_MAX >> shift) {
+        return false;
+    }
+    *value <<= shift;
+    *text = end;
+    return true;
+}
+
+// Función para leer una fuente de la especificación
+static inline bool parseWorkloadSource(const char **text, WorkloadSource *source) {
+    static const char *const names[] = {"uniform:", "zipf:", "loop:", "scan"};
+    const char *c = *text;
+    source->kind = -1;
+    for (int k = 0; k < 4; ++k) {
+        if (strncmp(c, names[k], strlen(names[k])) == 0) {
+            source->kind = k;
+            c += strlen(names[k]);
+            break;
+        }
+    }
+    if (source->kind < 0) {
+        return false;
+    }
+    source->exponent = 1.0;
+    source->base = source->kind == WORKLOAD_SCAN ? WORKLOAD_SCAN_BASE : 0;
+    if (source->kind != WORKLOAD_SCAN && (!parseWorkloadCount(&c, &source->pages) || source->pages == 0)) {
+        return false;
+    }
+    if (source->kind == WORKLOAD_ZIPF && *c == ':') {
+        char *end;
+        source->exponent = strtod(c + 1, &end);
+        if (end == c + 1 || source->exponent <= 0.0) {
+            return false;
+        }
+        c = end;
+    }
+    uint64_t base = (uint64_t)source->base;
+    if (*c == '@') {
+        c++;
+        if (!parseWorkloadCount(&c, &base)) {
+            return false;
+        }
+    }
+
+    // Las páginas de la fuente no pueden llegar al bit 63 (reservado) ni, con '#' proceso, salir
+    // del espacio de páginas del proceso; un recorrido no tiene fin, así que solo se mira su base
+    uint64_t limit = 1ULL << 63;
+    uint64_t pid = 0;
+    if (*c == '#') {
+        c++;
+        if (!parseWorkloadCount(&c, &pid) || pid > MAX_PID) {
+            return false;
+        }
+        limit = 1ULL << PID_SHIFT;
+    }
+    if (base >= limit || (source->kind != WORKLOAD_SCAN && source->pages > limit - base)) {
+        return false;
+    }
+    source->base = (PageId)(pid << PID_SHIFT | base);
+    if (*c == '!') {
+        char *end;
+        double fraction = strtod(c + 1, &end);
+        if (end == c + 1 || fraction < 0.0 || fraction > 1.0) {
+            return false;
+        }
+        source->writes = fraction >= 1.0 ? UINT64_MAX : (uint64_t)(fraction * 18446744073709551616.0);
+        c = end;
+    }
+    *text = c;
+    return true;
+}
+
+// Función para preparar el muestreo de las fuentes de Zipf de una carga ya leída
+static inline bool prepareWorkloadSources(Workload *workload) {
+    for (int p = 0; p < workload->numPhases; ++p) {
+        for (int i = 0; i < workload->phases[p].numSources; ++i) {
+            WorkloadSource *source = &workload->phases[p].sources[i];
+            if (source->kind != WORKLOAD_ZIPF) {
+                continue;
+            }
+            if (source->pages <= WORKLOAD_ALIAS_MAX) {
+                source->alias = createZipfAlias(source->pages, source->exponent);
+                if (source->alias == NULL) {
+                    return false;
+                }
+            } else {
+                initZipf(&source->zipf, source->pages, source->exponent);
+            }
+        }
+    }
+    return true;
+}
+
+// Función para liberar una carga de trabajo
+static inline void destroyWorkload(Workload *workload) {
+    if (workload == NULL) {
+        return;
+    }
+    for (int p = 0; p < workload->numPhases; ++p) {
+        for (int i = 0; i < workload->phases[p].numSources; ++i) {
+            free(workload->phases[p].sources[i].alias);
+        }
+    }
+    free(workload);
+}
+
+// Función para crear una carga de trabajo a partir de su especificación y una semilla
+// Devuelve NULL si la especificación no es válida o no hay memoria
+static inline Workload* createWorkload(const char *spec, uint64_t seed) {
+    Workload *workload = (Workload *)calloc(1, sizeof(Workload));
+    if (workload == NULL) {
+        return NULL;
+    }
+    const char *c = spec;
+    bool ok = true;
+    while (ok) {
+        if (workload->numPhases == WORKLOAD_MAX_PHASES) {
+            ok = false;
+            break;
+        }
+        WorkloadPhase *phase = &workload->phases[workload->numPhases++];
+        double weights[WORKLOAD_MAX_SOURCES];
+        double total = 0.0;
+        for (;;) {
+            if (phase->numSources == WORKLOAD_MAX_SOURCES) {
+                ok = false;
+                break;
+            }
+            char *end;
+            double weight = strtod(c, &end);
+            if (end != c && *end == '*' && weight > 0.0) {
+                c = end + 1;
+            } else {
+                weight = 1.0;
+            }
+            if (!parseWorkloadSource(&c, &phase->sources[phase->numSources])) {
+                ok = false;
+                break;
+            }
+            weights[phase->numSources++] = weight;
+            total += weight;
+            if (*c != '+') {
+                break;
+            }
+            c++;
+        }
+        if (!ok) {
+            break;
+        }
+        // Pesos acumulados en escala 2^64; la última fuente cubre lo que quede por redondeo
+        double cumulative = 0.0;
+        for (int i = 0; i < phase->numSources; ++i) {
+            cumulative += weights[i];
+            double scaled = cumulative / total * 18446744073709551616.0;
+            phase->sources[i].weight = i + 1 == phase->numSources || scaled >= 18446744073709551615.0 ? UINT64_MAX : (uint64_t)scaled;
+        }
+        if (*c == '/') {
+            c++;
+            ok = parseWorkloadCount(&c, &phase->length) && phase->length > 0;
+        }
+        if (!ok || *c != ';') {
+            break;
+        }
+        c++;
+    }
+    if (!ok || *c != '\0' || !prepareWorkloadSources(workload)) {
+        destroyWorkload(workload);
+        return NULL;
+    }
+    seedWorkloadRng(&workload->rng, seed);
+    workload->key = workloadNext(&workload->rng);
+    workload->remaining = workload->phases[0].length;
+    return workload;
+}
+
+// Función para obtener una cota de la mayor referencia que la carga puede generar en 'count'
+// accesos, con el número de proceso y, si se marcan las escrituras, WRITE_FLAG (un recorrido avanza
+// como mucho una página por acceso)
+static inline uint64_t workloadMaxReference(const Workload *workload, uint64_t count) {
+    uint64_t maxPage = 0;
+    bool writes = false;
+    for (int p = 0; p < workload->numPhases; ++p) {
+        for (int i = 0; i < workload->phases[p].numSources; ++i) {
+            const WorkloadSource *source = &workload->phases[p].sources[i];
+            uint64_t span = source->kind == WORKLOAD_SCAN ? (count > 0 ? count : 1) : source->pages;
+            uint64_t last = (uint64_t)source->base + span - 1;
+            if (last < (uint64_t)source->base) {
+                last = UINT64_MAX;      // Un recorrido tan largo da la vuelta
+            }
+            maxPage = last > maxPage ? last : maxPage;
+            writes = writes || source->writes != 0;
+        }
+    }
+    return workload->keepWrites && writes ? maxPage | WRITE_FLAG : maxPage;
+}
+
+// Función para obtener la página de una fuente con el número aleatorio r
+static inline PageId workloadSourceNext(WorkloadSource *source, WorkloadRng *rng, uint64_t r) {
+    switch (source->kind) {
+    case WORKLOAD_UNIFORM:
+        return source->base + (PageId)(((unsigned __int128)r * source->pages) >> 64);
+    case WORKLOAD_ZIPF:
+        if (source->alias != NULL) {
+            return source->base + (PageId)zipfAliasRank(source->alias, source->pages, r);
+        }
+        return source->base + (PageId)zipfNext(&source->zipf, rng);
+    case WORKLOAD_LOOP: {
+        PageId page = source->base + (PageId)source->position;
+        source->position = source->position + 1 == source->pages ? 0 : source->position + 1;
+        return page;
+    }
+    default:
+        return source->base + (PageId)source->position++;
+    }
+}
+
+// Función para generar 'count' accesos de una sola fuente a partir del acceso número 'position'
+// (ciclos separados por tipo, para no elegir el tipo en cada acceso)
+static inline void generateFromSource(WorkloadSource *source, Workload *workload, PageId *trace, uint64_t count) {
+    uint64_t key = workload->key;
+    uint64_t position = workload->position;
+    if (source->kind == WORKLOAD_UNIFORM) {
+        for (uint64_t t = 0; t < count; ++t) {
+            uint64_t r = workloadHash(key, 2 * (position + t) + 1);
+            trace[t] = source->base + (PageId)(((unsigned __int128)r * source->pages) >> 64);
+        }
+    } else if (source->kind == WORKLOAD_ZIPF && source->alias != NULL) {
+        for (uint64_t t = 0; t < count; ++t) {
+            uint64_t r = workloadHash(key, 2 * (position + t) + 1);
+            trace[t] = source->base + (PageId)zipfAliasRank(source->alias, source->pages, r);
+        }
+    } else if (source->kind == WORKLOAD_LOOP) {
+        uint64_t next = source->position;
+        for (uint64_t t = 0; t < count; ++t) {
+            trace[t] = source->base + (PageId)next;
+            next = next + 1 == source->pages ? 0 : next + 1;
+        }
+        source->position = next;
+    } else if (source->kind == WORKLOAD_SCAN) {
+        for (uint64_t t = 0; t < count; ++t) {
+            trace[t] = source->base + (PageId)(source->position + t);
+        }
+        source->position += count;
+    } else {
+        for (uint64_t t = 0; t < count; ++t) {
+            trace[t] = workloadSourceNext(source, &workload->rng, 0);
+        }
+    }
+}
+
+// Función para marcar como escrituras los 'count' accesos de una fuente que empiezan en el acceso
+// número 'position' (el acceso t es escritura si hash(~key, t) cae en la fracción de escrituras)
+static inline void markWrites(const WorkloadSource *source, uint64_t key, uint64_t position, PageId *trace, uint64_t count) {
+    for (uint64_t t = 0; t < count; ++t) {
+        if (workloadHash(~key, position + t) < source->writes) {
+            trace[t] = (PageId)((uint64_t)trace[t] | WRITE_FLAG);
+        }
+    }
+}
+
+// Función para generar los siguientes 'count' accesos de la carga de trabajo; el acceso número t
+// usa hash(key, 2t) para elegir la fuente y hash(key, 2t + 1) para elegir la página, así la traza
+// no depende de cuántos accesos se pidan en cada llamada
+static inline void generateWorkload(Workload *workload, PageId *trace, uint64_t count) {
+    while (count > 0) {
+        WorkloadPhase *phase = &workload->phases[workload->phase];
+        uint64_t length = phase->length == 0 || workload->remaining > count ? count : workload->remaining;
+        if (phase->numSources == 1) {
+            generateFromSource(&phase->sources[0], workload, trace, length);
+            if (workload->keepWrites && phase->sources[0].writes != 0) {
+                markWrites(&phase->sources[0], workload->key, workload->position, trace, length);
+            }
+        } else {
+            for (uint64_t t = 0; t < length; ++t) {
+                uint64_t access = workload->position + t;
+                uint64_t choice = workloadHash(workload->key, 2 * access);
+                int i = 0;
+                while (choice > phase->sources[i].weight) {
+                    i++;
+                }
+                trace[t] = workloadSourceNext(&phase->sources[i], &workload->rng, workloadHash(workload->key, 2 * access + 1));
+                if (workload->keepWrites && phase->sources[i].writes != 0) {
+                    markWrites(&phase->sources[i], workload->key, access, &trace[t], 1);
+                }
+            }
+        }
+        workload->position += length;
+        trace += length;
+        count -= length;
+        if (phase->length != 0 && (workload->remaining -= length) == 0) {
+            workload->phase = (workload->phase + 1) % workload->numPhases;
+            workload->remaining = workload->phases[workload->phase].length;
+        }
+    }
+}
+
+#endif